@@ -476,6 +476,9 @@ class ObjectInformation:
         child_info = self.child_info('PanelManager', '0xWindowID')
         child_info.user_name_pattern = '0xWindowID'
         child_info.type = ClassName('Panel')
+        child_info = self.child_info('RuleManager', 'index')
+        child_info.user_name_pattern = 'INDEX'
+        child_info.type = ClassName('RuleObject')
 
     def attribute_info(self, classname: str, attr_cpp_name: str):
         """return the AttributeInformation object for
@@ -9,21 +9,32 @@ using std::string;
 using std::stringstream;
 
 ArgList::ArgList(const ArgList::Container &c)
-    : container_(make_shared<Container>(c))
-{ reset(); }
+    : ArgList(make_shared<const Container>(c))
+{}
 
-ArgList::ArgList(const ArgList &al) : container_(al.container_) { reset(); }
+ArgList::ArgList(std::shared_ptr<const Container> container)
+    : ArgList(container, container->cbegin(), container->cend())
+{}
 
-ArgList::ArgList(const string &s, char delim) {
-    container_ = make_shared<Container>(split(s, delim));
-    reset();
-}
+ArgList::ArgList(const ArgList &al)
+    : ArgList(al.container_, al.first_, al.end_)
+{}
+
+ArgList::ArgList(const string &s, char delim)
+    : ArgList(make_shared<const Container>(split(s, delim)))
+{}
 
 ArgList::ArgList(Container::const_iterator from, Container::const_iterator to)
-{
-    container_ = make_shared<Container>(from, to);
-    reset();
-}
+    : ArgList(make_shared<const Container>(from, to))
+{}
+
+ArgList::ArgList(std::shared_ptr<const Container> container,
+                 Container::const_iterator from, Container::const_iterator to)
+    : first_(from)
+    , begin_(from)
+    , end_(to)
+    , container_(container)
+{}
 
 ArgList::Container ArgList::split(const string &s, char delim) {
     Container ret;
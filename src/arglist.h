@@ -8,6 +8,14 @@
 #include <string>
 #include <vector>
 
+/*!
+ * A list of arguments, together with a pointer to the next argument to
+ * be parsed.
+ *
+ * An ArgList is a view on a range of a shared (and immutable)
+ * argument vector. So copying an ArgList or taking a sub-range of it does
+ * not copy the arguments themselves.
+ */
 class ArgList {
 
 public:
@@ -19,32 +27,37 @@ public:
     ArgList(Container::const_iterator from, Container::const_iterator to);
     ArgList(const ArgList &al);
     ArgList(const Container &c);
+    ArgList(std::shared_ptr<const Container> container);
     // constructor that splits the given string
     ArgList(const std::string &s, char delim = '.');
     virtual ~ArgList() {}
 
     Container::const_iterator begin() const { return begin_; }
-    Container::const_iterator end() const { return container_->cend(); }
+    Container::const_iterator end() const { return end_; }
     const std::string& front() { return *begin_; }
-    const std::string& back() { return container_->back(); }
-    bool empty() const { return begin_ == container_->end(); }
+    const std::string& back() { return *(end_ - 1); }
+    bool empty() const { return begin_ == end_; }
     Container::size_type size() const {
-        return std::distance(begin_, container_->cend());
+        return std::distance(begin_, end_);
     }
 
     std::string join(char delim = '.');
 
     //! reset internal pointer to begin of arguments
     void reset() {
-        begin_ = container_->cbegin();
+        begin_ = first_;
         shiftedTooFar_ = false;
     }
     //! shift the internal pointer by amount
     void shift(Container::difference_type amount = 1) {
-        begin_ += std::min(amount, std::distance(begin_, container_->cend()));
+        begin_ += std::min(amount, std::distance(begin_, end_));
     }
     Container toVector() const {
-        return Container(begin_, container_->cend());
+        return Container(begin_, end_);
+    }
+    //! the remaining arguments, sharing the argument vector with this
+    ArgList remaining() const {
+        return ArgList(container_, begin_, end_);
     }
     //! try read a value if possible
     virtual ArgList& operator>>(std::string& val);
@@ -55,17 +68,26 @@ public:
     }
 
 protected:
+    //! the view on the range [from, to) of the given container
+    ArgList(std::shared_ptr<const Container> container,
+            Container::const_iterator from, Container::const_iterator to);
+
+    //! the first argument of the view, i.e. where reset() goes to
+    Container::const_iterator first_;
     //! shift state pointing into container_
     Container::const_iterator begin_;
+    //! the end of the view
+    Container::const_iterator end_;
     //! indicator that we attempted to shift too far (shift is at end())
     bool shiftedTooFar_ = false;
     /*! Argument vector
      * @note This is a shared pointer to make object copy-able:
      * 1. payload is shared (no redundant copies)
      * 2. begin_ stays valid
-     * 3. The C-style compatibility layer DEPENDS on the shared_ptr!
+     * The vector is never modified, so if the arguments have to be changed,
+     * then the view needs to be moved to a copy of the vector.
      */
-    std::shared_ptr<Container> container_;
+    std::shared_ptr<const Container> container_;
 };
 
 #endif
@@ -244,10 +244,7 @@ void ArgParse::command(CallOrComplete invocation,
             status = exitCode();
         } else {
             // if parsing did not fail, extract the remaining tokens:
-            ArgList remainingTokens = {
-                invocation.inputOutput_->first.begin(),
-                invocation.inputOutput_->first.end()
-            };
+            ArgList remainingTokens = invocation.inputOutput_->first.remaining();
             status = command(remainingTokens, invocation.inputOutput_->second);
         }
         if (invocation.exitCode_) {
@@ -7,11 +7,11 @@
 
 using std::string;
 
-ByName::ByName(Object& parent_)
-    : parent(parent_)
+ByName::ByName(Object& parentObject)
+    : parent(parentObject)
 {
-    parent_.addChild(this, "by-name");
-    parent_.addHook(this);
+    parentObject.addChild(this, "by-name");
+    parentObject.addHook(this);
     setDoc(
         "This has an entry \'name\' for every object with "
         "the given \'name\'. If an object has an empty name "
@@ -37,7 +37,7 @@ void ByName::childAdded(Object* sender_parent, string child_name)
         child->addHook(this);
         if (!name_attrib->str().empty()) {
             // we only list it, if the name is non-empty
-            addChild(child, name_attrib->str());
+            addChildReference(child, name_attrib->str());
         }
     }
 }
@@ -78,7 +78,7 @@ void ByName::attributeChanged(Object* child, string attribute_name)
     }
     last_name[child] = new_name;
     if (!new_name.empty()) {
-        addChild(child, new_name);
+        addChildReference(child, new_name);
     }
 }
 
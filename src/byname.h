@@ -11,7 +11,7 @@ class ByName : public Object, public Hook {
 public:
     // ByName is an object making each child of 'parent' addressible by its
     // name
-    ByName(Object& parent);
+    ByName(Object& parentObject);
     ~ByName() override;
 
     void childAdded(Object* parent, std::string child_name) override;
@@ -0,0 +1,115 @@
+#include "changejournal.h"
+
+#include <vector>
+
+#include "argparse.h"
+#include "ipc-protocol.h"
+
+using std::string;
+using std::vector;
+
+ChangeJournal::ChangeJournal()
+    : capacity_(this, "capacity", 1000)
+    , generation_(this, "generation", &ChangeJournal::generation)
+    , size_(this, "size", &ChangeJournal::size)
+{
+    capacity_.setWritable();
+    capacity_.changed().connect(this, &ChangeJournal::trim);
+    setDoc("The journal records all changes in the object tree, "
+           "such that a client can ask for all changes since "
+           "a certain point in time via the changes_since command.");
+    capacity_.setDoc("the maximum number of changes that are remembered");
+    generation_.setDoc("the generation number of the most recent change; "
+                       "every change increases it by one");
+    size_.setDoc("the number of changes that are currently remembered");
+}
+
+ChangeJournal::~ChangeJournal()
+{
+    injectDependencies(nullptr);
+}
+
+//! start recording the changes in the object tree below the given root
+void ChangeJournal::injectDependencies(Object* root)
+{
+    if (root_) {
+        Object::setTreeHook(nullptr);
+    }
+    root_ = root;
+    if (root_) {
+        Object::setTreeHook(this);
+    }
+}
+
+void ChangeJournal::childAdded(Object* parent, string child_name)
+{
+    record("child_added", parent, child_name);
+}
+
+void ChangeJournal::childRemoved(Object* parent, string child_name)
+{
+    record("child_removed", parent, child_name);
+}
+
+void ChangeJournal::attributeChanged(Object* sender, string attribute_name)
+{
+    record("attribute_changed", sender, attribute_name);
+}
+
+/**
+ * @brief record a change of the entry 'name' in the given object.
+ * Changes in objects that are not (yet) part of the object tree are
+ * ignored.
+ */
+void ChangeJournal::record(const char* event, Object* object, const string& name)
+{
+    vector<const string*> names = { &name };
+    while (object && object != root_) {
+        names.push_back(&object->nameInParent());
+        object = object->parent();
+    }
+    if (!object) {
+        return;
+    }
+    string path;
+    for (auto it = names.rbegin(); it != names.rend(); it++) {
+        if (!path.empty()) {
+            path += OBJECT_PATH_SEPARATOR;
+        }
+        path += **it;
+    }
+    lastGeneration_++;
+    entries_.push_back({lastGeneration_, event, path});
+    trim();
+}
+
+//! drop the oldest entries exceeding the capacity
+void ChangeJournal::trim()
+{
+    while (entries_.size() > capacity_()) {
+        entries_.pop_front();
+    }
+}
+
+void ChangeJournal::changesSinceCommand(CallOrComplete invoc)
+{
+    unsigned long since = 0;
+    ArgParse().mandatory(since).command(invoc,
+        [&] (Output output) {
+        output << lastGeneration_ << "\n";
+        // the generation of the oldest change we still know
+        unsigned long oldest = entries_.empty()
+                ? lastGeneration_ + 1
+                : entries_.front().generation;
+        if (since > lastGeneration_ || since + 1 < oldest) {
+            output << "resync\n";
+            return HERBST_EXIT_SUCCESS;
+        }
+        for (auto it = entries_.begin() + (since + 1 - oldest);
+             it != entries_.end(); it++)
+        {
+            output << it->generation << " " << it->event << " " << it->path << "\n";
+        }
+        return HERBST_EXIT_SUCCESS;
+    });
+}
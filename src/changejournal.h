@@ -0,0 +1,49 @@
+#pragma once
+
+#include <deque>
+#include <string>
+
+#include "attribute_.h"
+#include "commandio.h"
+#include "hook.h"
+#include "object.h"
+
+/**
+ * @brief The ChangeJournal records every change in the object tree, i.e.
+ * every added or removed child and every changed attribute, together
+ * with a generation number that increases by one with every change.
+ * Only the most recent changes are kept. This allows clients to
+ * keep a mirror of (a part of) the object tree up to date by
+ * asking for the changes since the generation they have seen last.
+ */
+class ChangeJournal : public Object, public Hook {
+public:
+    ChangeJournal();
+    ~ChangeJournal() override;
+    void injectDependencies(Object* root);
+
+    Attribute_<unsigned long> capacity_;
+    DynAttribute_<unsigned long> generation_;
+    DynAttribute_<unsigned long> size_;
+
+    void changesSinceCommand(CallOrComplete invoc);
+
+    void childAdded(Object* parent, std::string child_name) override;
+    void childRemoved(Object* parent, std::string child_name) override;
+    void attributeChanged(Object* sender, std::string attribute_name) override;
+private:
+    class Entry {
+    public:
+        unsigned long generation;
+        const char* event;
+        std::string path;
+    };
+    void record(const char* event, Object* object, const std::string& name);
+    void trim();
+    unsigned long generation() const { return lastGeneration_; }
+    unsigned long size() const { return entries_.size(); }
+
+    Object* root_ = nullptr;
+    unsigned long lastGeneration_ = 0;
+    std::deque<Entry> entries_;
+};
@@ -19,6 +19,7 @@
 #include "monitormanager.h"
 #include "mousemanager.h"
 #include "root.h"
+#include "settings.h"
 #include "stack.h"
 #include "tag.h"
 #include "theme.h"
@@ -66,6 +67,7 @@ Client::Client(Window window, bool visible_already, ClientManager& cm)
     , ewmh(*cm.ewmh)
     , X_(*cm.X_)
     , decParams(make_unique<DecorationParameters>())
+    , titleUpdateTimeout_([this]() { update_title(); })
 {
     stringstream tmp;
     window_id_str = WindowID(window).str();
@@ -231,7 +233,14 @@ void Client::listen_for_events() {
 }
 
 void Client::setTag(HSTag *tag) {
+    if (tag_) {
+        tag_->adjustClientCounts(-1, urgentOnTag_ ? -1 : 0);
+    }
     tag_ = tag;
+    urgentOnTag_ = urgent_();
+    if (tag_) {
+        tag_->adjustClientCounts(1, urgentOnTag_ ? 1 : 0);
+    }
     ewmh.windowUpdateTag(window_, tag);
 }
 
@@ -267,7 +276,11 @@ void Client::recomputeStyle()
 void Client::redraw()
 {
     decParams->updateTabUrgencyFlags();
-    dec->setParameters(*decParams);
+    if (!dec->isCovered()) {
+        // a covered decoration updates its style
+        // when it becomes visible again
+        dec->setParameters(*decParams);
+    }
     dec->redraw();
 }
 
@@ -275,7 +288,9 @@ void Client::redrawRelevantTabBars()
 {
     if (!is_client_floated()) {
         // if this client is mentioned in another client's tab bar,
-        // then update also that
+        // then update also that. Only the visible tab bar is actually
+        // repainted, the covered ones are repainted by the layout
+        // that makes them visible.
         FrameLeaf* parent = parentFrame();
         if (parent && parent->getLayout() == LayoutAlgorithm::max) {
             parent->foreachClient([&](Client* otherClient) {
@@ -292,6 +307,7 @@ void Client::resize_fullscreen(Rectangle monitor_rect, bool isFocused) {
     decParams->focused_ = isFocused;
     decParams->fullscreen_ = true;
     decParams->urgent_ = urgent_();
+    dec->setCovered(false);
     dec->setParameters(*decParams);
     dec->resize_outline(monitor_rect);
 }
@@ -311,8 +327,9 @@ void Client::lower()
  * @param whether this client has the focus
  * @param whether the client should use the 'minimal decoration' scheme
  * @param the tabs of the current window
+ * @param whether the client is entirely covered by another client
  */
-void Client::resize_tiling(Rectangle rect, bool isFocused, bool minimalDecoration, vector<Client*> tabs) {
+void Client::resize_tiling(Rectangle rect, bool isFocused, bool minimalDecoration, vector<Client*> tabs, bool covered) {
     // only apply minimal decoration if the window is not pseudotiled
     *decParams = DecorationParameters();
     decParams->minimal_ = minimalDecoration && !this->pseudotile_();
@@ -324,6 +341,7 @@ void Client::resize_tiling(Rectangle rect, bool isFocused, bool minimalDecoratio
     for (const Client* tab : tabs) {
         decParams->urgentTabs_.push_back(tab->urgent_());
     }
+    dec->setCovered(covered);
     dec->setParameters(*decParams);
     if (this->pseudotile_) {
         Rectangle inner = this->float_size_;
@@ -533,6 +551,7 @@ void Client::resize_floating(Monitor* m, bool isFocused) {
     decParams->floating_ = true;
     decParams->focused_ = isFocused;
     decParams->urgent_ = urgent_();
+    dec->setCovered(false);
     dec->setParameters(*decParams);
     dec->resize_inner(rect);
 }
@@ -595,6 +614,10 @@ void Client::forgetOtherClient(Client* otherClient)
 
 void Client::urgencyAttributeChanged(bool state)
 {
+    if (tag_ && urgentOnTag_ != state) {
+        tag_->adjustClientCounts(0, state ? 1 : -1);
+        urgentOnTag_ = state;
+    }
     if (this == manager.focus() && state == true) {
         // suppress it if the focused client wants to be urgent
         urgent_ = false;
@@ -649,6 +672,8 @@ void Client::readWmHints(bool forceNotUrgent) {
 }
 
 void Client::update_title() {
+    titleUpdateTimeout_.stop();
+    lastTitleUpdate_ = Timeout::Clock::now();
     string newName = ewmh.getWindowTitle(window_);
     bool changed = title_() != newName;
     title_ = newName;
@@ -657,6 +682,32 @@ void Client::update_title() {
     }
 }
 
+/**
+ * @brief to be called whenever the window changes its title property.
+ * If the setting title_refresh_rate is set, then the first change is
+ * applied immediately and all further changes within the refresh interval
+ * are coalesced into a single update at the end of the interval.
+ */
+void Client::titlePropertyChanged()
+{
+    int rate = settings.title_refresh_rate();
+    if (rate <= 0) {
+        update_title();
+        return;
+    }
+    if (titleUpdateTimeout_.isActive()) {
+        // the latest title will be fetched when the timeout fires
+        return;
+    }
+    auto interval = std::chrono::microseconds(1000000 / rate);
+    auto nextUpdate = lastTitleUpdate_ + interval;
+    if (Timeout::Clock::now() >= nextUpdate) {
+        update_title();
+    } else {
+        titleUpdateTimeout_.startAt(nextUpdate);
+    }
+}
+
 Client* get_current_client() {
     return Root::get()->monitors->focus()->tag->focusedClient();
 }
@@ -11,6 +11,7 @@
 #include "object.h"
 #include "rectangle.h"
 #include "regexstr.h"
+#include "timeout.h"
 #include "x11-types.h"
 
 class Decoration;
@@ -39,6 +40,7 @@ public:
     Rectangle   last_size_;      // last size excluding the window border
     Attribute_<Rectangle> float_size_;     // floating size without the window border
     HSTag*      tag_ = {};
+    bool        urgentOnTag_ = false; // whether tag_ counts this client as urgent
     Slice* slice = {};
     bool        ewmhfullscreen_ = false; // ewmh fullscreen state
     bool        neverfocus_ = false; // do not give the focus via XSetInputFocus
@@ -111,13 +113,14 @@ public:
     Rectangle outer_floating_rect();
 
     void recomputeStyle();
-    void resize_tiling(Rectangle rect, bool isFocused, bool minimalDecoration, std::vector<Client*> tabs);
+    void resize_tiling(Rectangle rect, bool isFocused, bool minimalDecoration, std::vector<Client*> tabs, bool covered = false);
     void resize_floating(Monitor* m, bool isFocused);
     void resize_fullscreen(Rectangle m, bool isFocused);
     bool is_client_floated();
     void set_urgent(bool state);
     void readWmHints(bool forceNotUrgent = false);
     void update_title();
+    void titlePropertyChanged();
     void raise();
     void lower();
 
@@ -155,6 +158,8 @@ private:
     XConnection& X_;
     std::string tagName();
     std::unique_ptr<DecorationParameters> decParams; // pimpl
+    Timeout titleUpdateTimeout_; //! pending update if title changes are rate limited
+    Timeout::Clock::time_point lastTitleUpdate_ = {};
 };
 
 
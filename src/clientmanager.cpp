@@ -262,7 +262,11 @@ Client* ClientManager::manage_client(Window win, bool visible_already, bool forc
     ewmh->updateWindowState(client);
     // add client after setting the correct tag for the new client
     // this ensures a panel can read the tag property correctly at this point
-    ewmh->addClient(client->window_);
+    if (bulkImport_) {
+        bulkImportedWindows_.push_back(client->window_);
+    } else {
+        ewmh->addClient(client->window_);
+    }
 
     client->make_full_client();
 
@@ -275,7 +279,9 @@ Client* ClientManager::manage_client(Window win, bool visible_already, bool forc
         monitor->evaluateClientPlacement(client, changes.floatplacement);
         // TODO: monitor_apply_layout() maybe is called twice here if it
         // already is called by monitor_set_tag()
-        monitor->applyLayout();
+        if (!bulkImport_) {
+            monitor->applyLayout();
+        }
         client->set_visible(true);
     } else {
         if (changes.focus && changes.switchtag) {
@@ -298,6 +304,26 @@ Client* ClientManager::manage_client(Window win, bool visible_already, bool forc
     return client;
 }
 
+void ClientManager::beginBulkImport()
+{
+    bulkImport_ = true;
+}
+
+void ClientManager::endBulkImport()
+{
+    bulkImport_ = false;
+    // windows might have been unmanaged again in the meantime
+    vector<Window> windows;
+    for (Window win : bulkImportedWindows_) {
+        if (client(win)) {
+            windows.push_back(win);
+        }
+    }
+    bulkImportedWindows_.clear();
+    ewmh->addClients(windows);
+    Root::get()->monitors->relayoutAll();
+}
+
 //! apply some built in rules that reflect the EWMH specification
 //! and regarding sensible single-window floating settings
 ClientChanges ClientManager::applyDefaultRules(Window win)
@@ -588,6 +614,7 @@ void ClientManager::force_unmanage(Client* client) {
     // and arrange monitor after the client has been removed from the stack
     needsRelayout.emit(tag);
     ewmh->removeClient(client->window_);
+    client->setTag(nullptr);
     tag_set_flags_dirty();
     // delete client
     this->remove(client->window_);
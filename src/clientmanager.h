@@ -64,6 +64,12 @@ public:
     Client* manage_client(Window win, bool visible_already, bool force_unmanage,
                           std::function<void(ClientChanges&)> additionalRules = {});
     ClientChanges applyDefaultRules(Window win);
+    /** between these calls, manage_client() defers the relayout and the
+     * update of the ewmh client list, such that many windows can be
+     * managed at once (e.g. on startup) with only a single update
+     */
+    void beginBulkImport();
+    void endBulkImport();
 
     int applyRulesCmd(Input input, Output output);
     int applyRules(Client* client, Output output, bool changeFocus = true);
@@ -81,6 +87,8 @@ protected:
     Ewmh* ewmh;
     XConnection* X_;
     std::unordered_map<Window, Client*> clients_;
+    bool bulkImport_ = false;
+    std::vector<Window> bulkImportedWindows_; //! not yet in the ewmh client list
     friend class Client;
 };
 
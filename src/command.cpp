@@ -1,5 +1,6 @@
 #include "command.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <sstream>
@@ -44,6 +45,25 @@ void CommandBinding::complete(Completion& completion) const {
 }
 
 // Implementation of CommandTable
+CommandTable::CommandTable(std::initializer_list<Container::value_type> values)
+    : map(values)
+{
+    for (const auto& it : map) {
+        sortedNames_.push_back(it.first);
+    }
+    std::sort(sortedNames_.begin(), sortedNames_.end());
+}
+
+vector<string> CommandTable::namesWithPrefix(const string& prefix) const
+{
+    auto first = std::lower_bound(sortedNames_.begin(), sortedNames_.end(), prefix);
+    auto last = first;
+    while (last != sortedNames_.end() && stringStartsWith(*last, prefix)) {
+        last++;
+    }
+    return vector<string>(first, last);
+}
+
 int CommandTable::callCommand(Input args, Output out) const {
     if (args.command().empty()) {
         // may happen if you call sprintf, but nothing afterwards
@@ -63,11 +83,13 @@ int CommandTable::callCommand(Input args, Output out) const {
 
 namespace Commands {
     shared_ptr<const CommandTable> command_table;
+    unsigned long command_table_generation = 0;
 }
 
 void Commands::initialize(unique_ptr<const CommandTable> commands) {
     if (!command_table) {
         command_table = move(commands);
+        command_table_generation++;
     }
     // TODO What do we do in the 'already initialized' case?
 }
@@ -87,6 +109,23 @@ bool Commands::commandExists(const string& commandName)
     return command_table->find(commandName) != command_table->end();
 }
 
+const CommandBinding* Commands::find(const string& commandName)
+{
+    if (!command_table) {
+        return nullptr;
+    }
+    auto it = command_table->find(commandName);
+    if (it == command_table->end()) {
+        return nullptr;
+    }
+    return &(it->second);
+}
+
+unsigned long Commands::generation()
+{
+    return command_table_generation;
+}
+
 shared_ptr<const CommandTable> Commands::get() {
     if (!command_table) {
         throw std::logic_error("CommandTable not initialized, but get() called.");
@@ -97,8 +136,8 @@ shared_ptr<const CommandTable> Commands::get() {
 void Commands::complete(Completion& completion) {
     auto commandTable = Commands::get();
     if (completion == 0) {
-        for (const auto& cmd : *commandTable) {
-            completion.full(cmd.first);
+        for (const auto& name : commandTable->namesWithPrefix(completion.wordPrefix())) {
+            completion.full(name);
         }
     } else {
         auto it = commandTable->find(completion[0]);
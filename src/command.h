@@ -4,6 +4,7 @@
 #include <functional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "commandio.h"
 
@@ -128,16 +129,19 @@ class CommandTable {
     using Container = std::unordered_map<std::string, CommandBinding>;
 
 public:
-    CommandTable(std::initializer_list<Container::value_type> values)
-        : map(values) {}
+    CommandTable(std::initializer_list<Container::value_type> values);
 
     int callCommand(Input args, Output out) const;
 
     Container::const_iterator begin() const { return map.cbegin(); }
     Container::const_iterator end() const { return map.cend(); }
     Container::const_iterator find(const std::string& str) const { return map.find(str); }
+    //! the names of all commands starting with the given prefix
+    std::vector<std::string> namesWithPrefix(const std::string& prefix) const;
 private:
     Container map;
+    //! all command names in sorted order, for looking up name prefixes
+    std::vector<std::string> sortedNames_;
 };
 
 namespace Commands {
@@ -145,6 +149,12 @@ namespace Commands {
     /* Call the command args[0] */
     int call(Input args, Output out);
     bool commandExists(const std::string& commandName);
+    //! the binding of the given command or nullptr if there is none
+    const CommandBinding* find(const std::string& commandName);
+    /** A counter that changes whenever the command table is replaced,
+     * invalidating all pointers returned by find()
+     */
+    unsigned long generation();
     void complete(Completion& completion);
     std::shared_ptr<const CommandTable> get();
 }
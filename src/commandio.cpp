@@ -1,5 +1,6 @@
 #include "commandio.h"
 
+#include <algorithm>
 #include <iostream>
 
 #include "completion.h"
@@ -14,27 +15,57 @@ Input &Input::operator>>(string &val)
     return *this;
 }
 
+Input::Input(std::shared_ptr<const Container> argv)
+    : Input(argv, argv->cbegin(), argv->cbegin() + 1, argv->cend())
+{
+}
+
+Input::Input(std::shared_ptr<const Container> container,
+             Container::const_iterator command,
+             Container::const_iterator from, Container::const_iterator to)
+    : ArgList(container, from, to)
+    // share the ownership of the container, but point to the command:
+    , command_(container, &(*command))
+{
+}
+
 Input Input::fromHere()
 {
-    string cmd;
     if (empty()) {
         return {{}, {}};
     }
+    return slice(begin(), end());
+}
 
-    return Input(*(begin()), Container(begin() + 1, end()));
+Input Input::slice(Container::const_iterator from, Container::const_iterator to) const
+{
+    if (from == to) {
+        return {{}, {}};
+    }
+    return Input(container_, from, from + 1, to);
 }
 
 void Input::replace(const string &from, const string &to)
 {
-    for (auto &v : *container_) {
+    if (*command_ == from) {
+        command_ = std::make_shared<const string>(to);
+    }
+    if (std::find(first_, end_, from) == end_) {
+        // nothing to replace, so keep sharing the arguments
+        return;
+    }
+    // copy on write: replace the tokens in a copy of the arguments
+    auto offset = std::distance(first_, begin_);
+    auto arguments = std::make_shared<Container>(first_, end_);
+    for (auto &v : *arguments) {
         if (v == from) {
             v = to;
         }
-
-        if (*command_ == from) {
-            *command_ = to;
-        }
     }
+    container_ = arguments;
+    first_ = container_->cbegin();
+    begin_ = first_ + offset;
+    end_ = container_->cend();
 }
 
 OutputChannels OutputChannels::stdio() {
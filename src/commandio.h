@@ -85,9 +85,14 @@ public:
     Input(const std::string command, Container::const_iterator from, Container::const_iterator to)
         : ArgList(from, to), command_(std::make_shared<std::string>(command)) {}
 
+    //! create an Input from a non-empty argv, where argv[0] is the command.
+    //! The argv is shared, not copied.
+    Input(std::shared_ptr<const Container> argv);
+
     //! create a new Input but drop already parsed arguments
     Input(const Input& other)
-        : ArgList(other.toVector()), command_(other.command_) {}
+        : ArgList(other.container_, other.begin_, other.end_)
+        , command_(other.command_) {}
 
     const std::string& command() const { return *command_; }
 
@@ -96,15 +101,28 @@ public:
     //! construct a new Input where the first (current) arg is the command
     Input fromHere();
 
+    /*! construct a new Input from the range [from, to) of this Input's
+     * arguments, where *from is the command. The arguments are shared,
+     * not copied.
+     */
+    Input slice(Container::const_iterator from, Container::const_iterator to) const;
+
     //! Replace every occurence of 'from' by 'to'
     //! @note this includes the command itself
     void replace(const std::string &from, const std::string &to);
 
 protected:
+    //! the new input for the view [from, to) on the container
+    //! and the command name from the container.
+    Input(std::shared_ptr<const Container> container,
+          Container::const_iterator command,
+          Container::const_iterator from, Container::const_iterator to);
+
     //! Command name
-    //! A shared pointer to avoid copies when passing Input around
-    //! @note The C-style compatibility layer DEPENDS on the shared_ptr!
-    std::shared_ptr<std::string> command_;
+    //! A shared pointer to avoid copies when passing Input around. It
+    //! possibly points into the argument vector (and then shares ownership
+    //! of the vector).
+    std::shared_ptr<const std::string> command_;
 };
 
 /**
@@ -93,6 +93,19 @@ const string& Completion::needle() const
     return needle_;
 }
 
+/** a prefix that all words passed to full() or partial() need to have
+ * in order to be a completion result. So callers with many candidates
+ * can skip all words that do not have this prefix.
+ */
+string Completion::wordPrefix() const
+{
+    if (needle_.size() > prepend_.size() && prefixOf(prepend_, needle_)) {
+        return needle_.substr(prepend_.size());
+    }
+    // otherwise, either every word or no word at all is a result
+    return "";
+}
+
 /** get a positional argument in the current completion situation
  *
  * if for a int 'index' the expression operator==(index) is true, then
@@ -68,6 +68,7 @@ public:
 
     static bool prefixOf(const std::string& shorter, const std::string& longer);
     const std::string& needle() const;
+    std::string wordPrefix() const;
     size_t needleIndex() const { return index_; };
 
     /** Grants access to private members as long as Commands::complete is still
@@ -378,6 +378,7 @@ void debugCssCommand(CallOrComplete invoc)
     bool treeIndexPresent = false;
     vector<int> treeIndex = {};
     Client* client = nullptr;
+    Client* renderClient = nullptr;
     ArgParse ap;
     ap.flags({
         {"--stylesheet=", cssSource },
@@ -385,6 +386,7 @@ void debugCssCommand(CallOrComplete invoc)
         {"--tree=", tree },
         {"--print-tree", &printTree },
         {"--pretty-client-tree=", client },
+        {"--render-client=", renderClient },
         {"--query-tree-indices=", cssSelectorStr },
         {"--compute-style=", treeIndex, &treeIndexPresent},
     });
@@ -419,6 +421,9 @@ void debugCssCommand(CallOrComplete invoc)
             if (client) {
                 client->dec->printDomTree(output);
             }
+            if (renderClient) {
+                renderClient->dec->printImageHistogram(output);
+            }
             if (!cssSelectorStr.empty()) {
                 if (!tree) {
                     output.error() << "selector queries requires a tree";
@@ -4,6 +4,7 @@
 #include <X11/Xutil.h>
 #include <X11/cursorfont.h>
 #include <algorithm>
+#include <cstdio>
 #include <limits>
 #include <vector>
 
@@ -11,12 +12,14 @@
 #include "ewmh.h"
 #include "font.h"
 #include "fontdata.h"
+#include "image-widgetrender.h"
 #include "settings.h"
 #include "theme.h"
 #include "utils.h"
 #include "x11-widgetrender.h"
 #include "xconnection.h"
 
+using std::map;
 using std::string;
 using std::swap;
 using std::vector;
@@ -420,6 +423,32 @@ void Decoration::printDomTree(Output output)
     tree_print_to(widMain.treeInterface(), output);
 }
 
+/**
+ * @brief Render the decoration with the ImageWidgetRender (i.e. without
+ * the X server) and print its size followed by how often each (premultiplied)
+ * color occurs in the image.
+ */
+void Decoration::printImageHistogram(Output output)
+{
+    ImageWidgetRender image(settings_, widMain.geometryCached());
+    image.render(widMain);
+    map<uint32_t, size_t> colorCount;
+    for (uint32_t pixel : image.data()) {
+        colorCount[pixel]++;
+    }
+    output << image.width() << " " << image.height() << "\n";
+    for (const auto& it : colorCount) {
+        char color[16];
+        uint32_t alpha = it.first >> 24;
+        if (alpha == 0xff) {
+            snprintf(color, sizeof(color), "#%06x", it.first & 0xffffff);
+        } else {
+            snprintf(color, sizeof(color), "#%06x%02x", it.first & 0xffffff, alpha);
+        }
+        output << color << " " << it.second << "\n";
+    }
+}
+
 void Decoration::resize_outline(Rectangle outline)
 {
     Rectangle inner;
@@ -482,11 +511,15 @@ void Decoration::applyWidgetGeometries() {
     // TODO: reduce flickering
     XConnection& xcon = xconnection();
     if (decorated) {
-        redrawPixmap();
-        XSetWindowBackgroundPixmap(xcon.display(), decwin, pixmap);
-        if (!size_changed) {
-            // if size changes, then the window is cleared automatically
-            XClearWindow(xcon.display(), decwin);
+        if (!covered_) {
+            // a covered decoration is painted by the resize that
+            // makes it visible again
+            redrawPixmap();
+            XSetWindowBackgroundPixmap(xcon.display(), decwin, pixmap);
+            if (!size_changed) {
+                // if size changes, then the window is cleared automatically
+                XClearWindow(xcon.display(), decwin);
+            }
         }
         if (!client_->dragged_ || settings_.update_dragged_clients()) {
             XConfigureWindow(xcon.display(), win, mask, &changes);
@@ -554,10 +587,25 @@ XConnection& Decoration::xconnection()
 void Decoration::redraw()
 {
     if (client_->decorated_()) {
+        if (covered_) {
+            // nobody can see the decoration, and the layout
+            // repaints it when it becomes visible again
+            return;
+        }
         applyWidgetGeometries();
     }
 }
 
+/**
+ * @brief Set whether the decoration is entirely covered by another
+ * window. While being covered, the decoration is not painted; this
+ * is done lazily when it is resized while not being covered anymore.
+ */
+void Decoration::setCovered(bool covered)
+{
+    covered_ = covered;
+}
+
 // draw a decoration to the client->dec.pixmap
 void Decoration::redrawPixmap() {
     XConnection& xcon = xconnection();
@@ -93,6 +93,8 @@ public:
     // resize such that the window content fits into rect
     void resize_inner(Rectangle inner);
     void redraw();
+    void setCovered(bool covered);
+    bool isCovered() const { return covered_; }
 
     static Client* toClient(Window decoration_window);
 
@@ -108,6 +110,7 @@ public:
     ResizeAction resizeFromRoughCursorPosition(Point2D cursor);
     void removeFromTabBar(Client* otherClientTab);
     void printDomTree(Output output);
+    void printImageHistogram(Output output);
 
 private:
     Widget widMain;
@@ -136,6 +139,10 @@ private:
     int                     lastFrameExtentsRight = 0;
     int                     lastFrameExtentsBottom = 0;
     int                     lastFrameExtentsLeft = 0;
+    //! whether the decoration is entirely covered by another window,
+    //! e.g. by another tab in the max layout. Such decorations are not
+    //! painted until they become visible again
+    bool                    covered_ = false;
     // fill the area behind client with another window that does nothing,
     // especially not repainting or background filling to avoid flicker on
     // unmap
@@ -8,6 +8,7 @@
 
 #include "client.h"
 #include "clientmanager.h"
+#include "freezer.h"
 #include "globals.h"
 #include "hlwmcommon.h"
 #include "layout.h"
@@ -274,6 +275,11 @@ void Ewmh::updateWmName() {
 }
 
 void Ewmh::updateClientList() {
+    Freezer* freezer = Freezer::ifFrozen();
+    if (freezer) {
+        freezer->deferClientList();
+        return;
+    }
     X_.setPropertyWindow(X_.root(), netatom_[NetClientList], netClientList_);
 }
 
@@ -283,6 +289,11 @@ const Ewmh::InitialState &Ewmh::initialState()
 }
 
 void Ewmh::updateClientListStacking() {
+    Freezer* freezer = Freezer::ifFrozen();
+    if (freezer) {
+        freezer->deferClientListStacking();
+        return;
+    }
     // First: get the windows currently visible
     vector<Window> buf;
     auto addToVector = [&buf](Window w) { buf.push_back(w); };
@@ -309,6 +320,12 @@ void Ewmh::addClient(Window win) {
     updateClientListStacking();
 }
 
+void Ewmh::addClients(const vector<Window>& windows) {
+    netClientList_.insert(netClientList_.end(), windows.begin(), windows.end());
+    updateClientList();
+    updateClientListStacking();
+}
+
 void Ewmh::removeClient(Window win) {
     netClientList_.erase(std::remove(netClientList_.begin(), netClientList_.end(), win), netClientList_.end());
     updateClientList();
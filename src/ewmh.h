@@ -140,6 +140,7 @@ public:
     void updateAll();
 
     void addClient(Window win);
+    void addClients(const std::vector<Window>& windows);
     void removeClient(Window win);
     void updateWmName();
 
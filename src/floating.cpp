@@ -3,8 +3,6 @@
 #include <algorithm>
 #include <climits>
 #include <cstdlib>
-#include <limits>
-#include <unordered_set>
 
 #include "client.h"
 #include "decoration.h"
@@ -213,7 +211,6 @@ int Floating::find_edge_right_of(RectangleIdxVec rects, int idx) {
     return leftmost;
 }
 
-
 bool Floating::focusDirection(Direction dir) {
     if (g_settings->monitors_locked()) { return false; }
     HSTag* tag = get_current_monitor()->tag;
@@ -331,7 +328,6 @@ bool Floating::shiftDirection(Direction dir) {
     return true;
 }
 
-
 static bool resize_by_delta(Client* client, Direction dir, int delta) {
     int new_width = client->float_size_->width;
     int new_height = client->float_size_->height;
@@ -473,86 +469,9 @@ Point2D Floating::smartPlacement(HSTag* tag, Client* client, Point2D area, int g
         }
     });
 
-    // collect possible values for the x and y coordinates for the
-    // placement of 'client'
-    std::unordered_set<int> xValues;
-    std::unordered_set<int> yValues;
-    // use all corners of other windows
-    for (const auto& it : rects) {
-        xValues.insert(it.first.x);
-        xValues.insert(it.first.x + it.first.width);
-        yValues.insert(it.first.y);
-        yValues.insert(it.first.y + it.first.height);
-    }
-    // use screen corners
-    xValues.insert(gap); // top
-    yValues.insert(gap); // left
-    xValues.insert(area.x); // right
-    yValues.insert(area.y); // bottom
-
-    // interpret the x/y value picked as the coordinate
-    // of one of the four corners of the 'client'
-    vector<Point2D> windowCorners = {
-        { 0, 0}, // top left
-        { clientsize.x, 0 }, // top right
-        { 0, clientsize.y }, // bottom left
-        { clientsize.x, clientsize.y }, // bottom right
-    };
-    // the overlap with floating windows, with tiling windows,
-    // and the topleft position:
-    std::tuple<int, int, Point2D> best {
-        std::numeric_limits<int>::max(),
-        std::numeric_limits<int>::max(),
-        Point2D { gap, gap }
-    };
-    // find the x/y coordinate with the least overlap
-    for (int x : xValues) {
-        for (int y : yValues) {
-            for (const auto& corner : windowCorners) {
-                Rectangle suggested = {
-                    x - corner.x, y - corner.y,
-                    clientsize.x, clientsize.y,
-                };
-                Point2D topleft = suggested.tl();
-                // skip coordinates where the window is not entirely
-                // within the screen area
-                if (topleft.x < 0 || topleft.y < 0) {
-                    continue;
-                }
-                Point2D bottomright = suggested.br();
-                if (bottomright.x > area.x || bottomright.y > area.y) {
-                    continue;
-                }
-                int overlapFloat = 0; // overlap with floating windows
-                int overlapTiling = 0; // overlap with tiling windows
-                for (const auto& otherWindow : rects) {
-                    // compute the intersection with the otherWindow
-                    auto inters = suggested.intersectionWith(otherWindow.first);
-                    if (!inters) {
-                        // no intersection
-                        continue;
-                    }
-                    int delta = abs(inters.width * inters.height);
-                    if (otherWindow.second) {
-                        // if the otherWindow is a floating window
-                        overlapFloat += delta;
-                        if (overlapFloat < 0) {
-                            overlapFloat =  std::numeric_limits<int>::max();
-                        }
-                    } else {
-                        // if the otherWindow is a tiling window
-                        overlapTiling += delta;
-                        if (overlapTiling < 0) {
-                            overlapTiling =  std::numeric_limits<int>::max();
-                        }
-                    }
-                }
-                auto t = std::make_tuple(overlapFloat, overlapTiling, topleft);
-                best = std::min(best, t);
-            }
-        }
-    }
+    Point2D topleft = smartPlacement(rects, clientsize, area, gap);
     // transform the topleft coordinate of the outer window
     // to the topleft coordinate of the window content
-    return std::get<2>(best) + (client->float_size_->tl() - clientOuter.tl());
+    return topleft + (client->float_size_->tl() - clientOuter.tl());
 }
+
@@ -1,6 +1,9 @@
 #ifndef __HERBST_FLOATING_H_
 #define __HERBST_FLOATING_H_
 
+#include <utility>
+#include <vector>
+
 #include "commandio.h"
 #include "rectangle.h"
 
@@ -25,6 +28,8 @@ public:
     static bool resizeDirection(HSTag* tag, Client* client, Direction dir);
 
     static Point2D smartPlacement(HSTag* tag, Client* client, Point2D area, int gap);
+    static Point2D smartPlacement(const std::vector<std::pair<Rectangle, bool>>& rects,
+                                  Point2D size, Point2D area, int gap);
 
 private:
     static Point2D find_rectangle_collision_on_tag(HSTag* tag, Client* curfocus, Direction dir, Rectangle curfocusrect = {0,0,-1,-1});
@@ -1,5 +1,6 @@
 #include "font.h"
 
+#include <algorithm>
 #include <map>
 
 #include "fontdata.h"
@@ -23,10 +24,20 @@ Finite<TextAlign>::ValueList Finite<TextAlign>::values = ValueListPlain {
  * HSFont-objects have a shared pointer to the same FontData objects. When
  * there are no more HSFont objcts pointing to a particular FontData object
  * then this object is automatically deallocated, because this map here only
- * carries a weak pointer.
+ * carries a weak pointer (apart from the fonts kept in s_recentlyUsed).
  */
 std::map<string, weak_ptr<FontData>> HSFont::s_fontDescriptionToData;
 
+/**
+ * @brief The most recently used fonts, most recent first. Loading a font
+ * from the X server or fontconfig is expensive, so this list keeps the
+ * last few fonts alive even if no HSFont refers to them anymore. So
+ * switching back and forth between themes (or font attributes) does not
+ * reload the fonts every time.
+ */
+std::list<shared_ptr<FontData>> HSFont::s_recentlyUsed;
+const size_t HSFont::s_recentlyUsedMax = 8;
+
 /**
  * @brief remember a default font, which is used whenever text needs
  * to be drawn, without any concrete font provided.
@@ -50,6 +61,7 @@ HSFont HSFont::fromStr(const string& source)
         data->initFromStr(source); // possibly throws an exception
         s_fontDescriptionToData[source] = data;
     }
+    markRecentlyUsed(data);
     HSFont font;
     font.source_ = source;
     font.fontData_ = data;
@@ -78,6 +90,30 @@ HSFont HSFont::defaultFont()
 void HSFont::shutdown()
 {
     s_defaultFont.reset();
+    s_recentlyUsed.clear();
+}
+
+void HSFont::markRecentlyUsed(shared_ptr<FontData> data)
+{
+    auto it = std::find(s_recentlyUsed.begin(), s_recentlyUsed.end(), data);
+    if (it != s_recentlyUsed.end()) {
+        s_recentlyUsed.splice(s_recentlyUsed.begin(), s_recentlyUsed, it);
+        return;
+    }
+    s_recentlyUsed.push_front(data);
+    if (s_recentlyUsed.size() > s_recentlyUsedMax) {
+        s_recentlyUsed.pop_back();
+    }
+    // drop the entries of fonts that are not loaded anymore
+    for (auto entry = s_fontDescriptionToData.begin();
+         entry != s_fontDescriptionToData.end(); )
+    {
+        if (entry->second.expired()) {
+            entry = s_fontDescriptionToData.erase(entry);
+        } else {
+            entry++;
+        }
+    }
 }
 
 HSFont::HSFont()
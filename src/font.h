@@ -1,5 +1,6 @@
 #pragma once
 
+#include <list>
 #include <map>
 #include <memory>
 #include <string>
@@ -48,7 +49,10 @@ private:
     HSFont();
     std::string source_;
     std::shared_ptr<FontData> fontData_;
+    static void markRecentlyUsed(std::shared_ptr<FontData> data);
     static std::map<std::string, std::weak_ptr<FontData>> s_fontDescriptionToData;
+    static std::list<std::shared_ptr<FontData>> s_recentlyUsed;
+    static const size_t s_recentlyUsedMax;
     static std::shared_ptr<FontData> s_defaultFont;
 };
 
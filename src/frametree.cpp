@@ -28,7 +28,7 @@ using std::string;
 using std::vector;
 
 FrameTree::FrameTree(HSTag* tag, Settings* settings)
-    : rootLink_(*this, "root")
+    : rootLink_(*this, "root", true)
     , focused_frame_(*this, "focused_frame", &FrameTree::focusedFramePlainPtr)
     , tag_(tag)
     , settings_(settings)
@@ -0,0 +1,190 @@
+#include "freezer.h"
+
+#include <algorithm>
+
+#include "ewmh.h"
+#include "ipc-protocol.h"
+#include "ipc-server.h"
+#include "monitor.h"
+#include "monitormanager.h"
+#include "root.h"
+
+using std::map;
+using std::string;
+using std::vector;
+
+/** Hooks that describe a state (and not an event). If such a hook is
+ * emitted multiple times while frozen, only the last one is emitted on
+ * thaw. The map assigns to the hook name the indices of the arguments
+ * that identify what the state belongs to, e.g. the window.
+ * All other hooks are only dropped if they are exactly repeated.
+ */
+static const map<string, vector<size_t>> stateHooks = {
+    { "attribute_changed", { 1 } }, // attribute_changed PATH OLD NEW
+    { "focus_changed", {} },
+    { "fullscreen", { 2 } },
+    { "tag_changed", { 2 } }, // tag_changed TAG MONITOR
+    { "urgent", { 2 } },
+    { "window_title_changed", { 1 } },
+};
+
+Freezer::Freezer()
+    : level_(this, "level", &Freezer::level)
+    , pendingHookCount_(this, "pending_hooks", &Freezer::pendingHookCount)
+{
+    setDoc("Tells whether herbstluftwm is frozen via the 'freeze' command.");
+    level_.setDoc("the number of 'freeze' calls without a matching 'thaw'");
+    pendingHookCount_.setDoc("the number of hooks deferred so far; "
+                             "duplicates are dropped on the last 'thaw'");
+}
+
+void Freezer::injectDependencies(MonitorManager* monitors, Ewmh* ewmh, IpcServer* ipcServer)
+{
+    monitors_ = monitors;
+    ewmh_ = ewmh;
+    ipcServer_ = ipcServer;
+}
+
+Freezer* Freezer::ifFrozen()
+{
+    auto root = Root::get();
+    if (!root || !root->freeze() || root->freeze->freezeLevel_ == 0) {
+        return nullptr;
+    }
+    return root->freeze();
+}
+
+int Freezer::freezeCommand(Output)
+{
+    if (freezeLevel_ == 0) {
+        // the layout is deferred by the monitor lock
+        monitors_->lock();
+    }
+    freezeLevel_++;
+    freezeOwners_[ipcServer_->currentConnection()]++;
+    return 0;
+}
+
+int Freezer::thawCommand(Output output)
+{
+    if (freezeLevel_ == 0) {
+        output.perror() << "herbstluftwm is not frozen\n";
+        return HERBST_INVALID_ARGUMENT;
+    }
+    auto it = freezeOwners_.find(ipcServer_->currentConnection());
+    if (it == freezeOwners_.end()) {
+        // the caller does not hold a freeze itself, so it releases one of
+        // someone else, preferably one that is not owned by an ipc client
+        it = freezeOwners_.begin();
+    }
+    it->second--;
+    if (it->second == 0) {
+        freezeOwners_.erase(it);
+    }
+    release(1);
+    return 0;
+}
+
+//! release the freezes that an ipc client still holds when it disconnects
+void Freezer::ipcConnectionClosed(Window window)
+{
+    auto it = freezeOwners_.find(window);
+    if (it == freezeOwners_.end()) {
+        return;
+    }
+    unsigned long count = it->second;
+    freezeOwners_.erase(it);
+    release(count);
+}
+
+void Freezer::release(unsigned long count)
+{
+    freezeLevel_ -= std::min(count, freezeLevel_);
+    if (freezeLevel_ == 0) {
+        applyPendingChanges();
+    }
+}
+
+void Freezer::deferHook(const vector<string>& args)
+{
+    if (!args.empty()) {
+        deferredHooks_.push_back(args);
+    }
+}
+
+//! apply everything that was deferred while frozen
+void Freezer::applyPendingChanges()
+{
+    // applies the layout of all monitors that have changed
+    monitors_->unlock();
+    if (restackPending_) {
+        restackPending_ = false;
+        monitors_->restack();
+    }
+    if (monitorRestackPending_) {
+        monitorRestackPending_ = false;
+        for (Monitor* monitor : *monitors_) {
+            monitor->restack();
+        }
+    }
+    if (clientListPending_) {
+        clientListPending_ = false;
+        ewmh_->updateClientList();
+    }
+    if (clientListStackingPending_) {
+        clientListStackingPending_ = false;
+        ewmh_->updateClientListStacking();
+    }
+    for (const auto& hook : coalescedHooks()) {
+        ipcServer_->emitHook(hook);
+    }
+}
+
+/**
+ * @brief take the deferred hooks and drop the ones that are
+ * overridden by later hooks, see stateHooks. The remaining hooks are
+ * returned in the order of their last occurrence.
+ */
+vector<vector<string>> Freezer::coalescedHooks()
+{
+    vector<vector<string>> hooks;
+    hooks.swap(deferredHooks_);
+    map<vector<string>, size_t> key2index;
+    for (size_t i = 0; i < hooks.size(); i++) {
+        vector<string> key = hooks[i];
+        auto state = stateHooks.find(hooks[i].front());
+        if (state != stateHooks.end()) {
+            key = { hooks[i].front() };
+            for (size_t argIndex : state->second) {
+                if (argIndex < hooks[i].size()) {
+                    key.push_back(hooks[i][argIndex]);
+                }
+            }
+        }
+        auto previous = key2index.find(key);
+        if (previous != key2index.end()) {
+            vector<string>& previousHook = hooks[previous->second];
+            if (hooks[i].front() == "attribute_changed"
+                && hooks[i].size() >= 4 && previousHook.size() >= 4)
+            {
+                // report the value from before the freeze as the old value
+                hooks[i][2] = previousHook[2];
+            }
+            previousHook.clear();
+            previous->second = i;
+        } else {
+            key2index[key] = i;
+        }
+    }
+    // drop the overridden hooks and the attribute changes that have been
+    // undone in the meantime
+    hooks.erase(std::remove_if(hooks.begin(), hooks.end(),
+                               [](const vector<string>& hook) {
+                                   return hook.empty()
+                                       || (hook.front() == "attribute_changed"
+                                           && hook.size() >= 4
+                                           && hook[2] == hook[3]);
+                               }),
+                hooks.end());
+    return hooks;
+}
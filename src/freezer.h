@@ -0,0 +1,67 @@
+#pragma once
+
+#include <X11/X.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "attribute_.h"
+#include "commandio.h"
+#include "object.h"
+
+class Ewmh;
+class IpcServer;
+class MonitorManager;
+
+/**
+ * @brief The Freezer implements the freeze and thaw commands. While
+ * frozen, the layout is not applied, windows are not restacked, the
+ * EWMH client lists are not updated and hooks are not emitted. On the
+ * last thaw, all of this is done once for the final state, and hooks
+ * that only describe intermediate states are dropped.
+ *
+ * A freeze started by an ipc client (i.e. herbstclient) is released
+ * automatically when the connection of the client is closed. For this,
+ * every freeze is owned by the connection that started it, so a closed
+ * connection never releases freezes that other clients still hold.
+ */
+class Freezer : public Object {
+public:
+    Freezer();
+    void injectDependencies(MonitorManager* monitors, Ewmh* ewmh, IpcServer* ipcServer);
+    DynAttribute_<unsigned long> level_;
+    DynAttribute_<unsigned long> pendingHookCount_;
+
+    int freezeCommand(Output output);
+    int thawCommand(Output output);
+    void ipcConnectionClosed(Window window);
+
+    //! the freezer if there is an active freeze, otherwise nullptr
+    static Freezer* ifFrozen();
+
+    void deferRestack() { restackPending_ = true; }
+    void deferMonitorRestack() { monitorRestackPending_ = true; }
+    void deferClientList() { clientListPending_ = true; }
+    void deferClientListStacking() { clientListStackingPending_ = true; }
+    void deferHook(const std::vector<std::string>& args);
+private:
+    void release(unsigned long count);
+    void applyPendingChanges();
+    std::vector<std::vector<std::string>> coalescedHooks();
+    unsigned long level() const { return freezeLevel_; }
+    unsigned long pendingHookCount() const { return deferredHooks_.size(); }
+
+    MonitorManager* monitors_ = nullptr;
+    Ewmh* ewmh_ = nullptr;
+    IpcServer* ipcServer_ = nullptr;
+    unsigned long freezeLevel_ = 0;
+    //! the number of freezes held by each ipc client window. Freezes
+    //! that were not started via ipc (e.g. by a keybinding) are
+    //! held by the window 0. The counts add up to freezeLevel_.
+    std::map<Window, unsigned long> freezeOwners_;
+    bool restackPending_ = false;
+    bool monitorRestackPending_ = false;
+    bool clientListPending_ = false;
+    bool clientListStackingPending_ = false;
+    std::vector<std::vector<std::string>> deferredHooks_;
+};
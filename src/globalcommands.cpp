@@ -1,5 +1,8 @@
 #include "globalcommands.h"
 
+#include <sstream>
+#include <unordered_map>
+
 #include "argparse.h"
 #include "client.h"
 #include "clientmanager.h"
@@ -21,6 +24,7 @@ using std::shared_ptr;
 using std::function;
 using std::string;
 using std::endl;
+using std::vector;
 
 GlobalCommands::GlobalCommands(Root& root)
     : root_(root)
@@ -40,34 +44,67 @@ void GlobalCommands::tagStatusCommand(CallOrComplete invoc)
 
 void GlobalCommands::tagStatus(Monitor* monitor, Output output)
 {
-    tag_update_flags();
-    output << '\t';
+    // the output only depends on the tags, their flags, which tag is
+    // shown on which monitor and which monitor is focused. So only
+    // rebuild it if one of these changed.
+    vector<HSTag*> monitorTags;
+    for (Monitor* m : *root_.monitors()) {
+        monitorTags.push_back(m->tag);
+    }
+    unsigned long focusedMonitor = get_current_monitor()->index();
+    unsigned long monitorIndex = monitor->index();
+    if (monitorIndex >= tagStatusCache_.size()) {
+        tagStatusCache_.resize(monitorIndex + 1);
+    }
+    TagStatusCache& cache = tagStatusCache_[monitorIndex];
+    if (!cache.status.empty()
+        && cache.tagGeneration == tag_status_generation()
+        && cache.focusedMonitor == focusedMonitor
+        && cache.monitorTags == monitorTags)
+    {
+        output << cache.status;
+        return;
+    }
+    std::unordered_map<HSTag*, unsigned long> tagToMonitor;
+    for (unsigned long i = 0; i < monitorTags.size(); i++) {
+        tagToMonitor[monitorTags[i]] = i;
+    }
+    std::stringstream status;
+    status << '\t';
     for (size_t i = 0; i < root_.tags->size(); i++) {
         HSTag* tag = root_.tags->byIdx(i);
+        int flags = tag->flags();
         // print flags
         char c = '.';
-        if (tag->flags & TAG_FLAG_USED) {
+        if (flags & TAG_FLAG_USED) {
             c = ':';
         }
-        Monitor* tag_monitor = root_.monitors->byTag(tag);
-        if (tag_monitor == monitor) {
-            c = '+';
-            if (monitor == get_current_monitor()) {
-                c = '#';
-            }
-        } else if (tag_monitor) {
-            c = '-';
-            if (get_current_monitor() == tag_monitor) {
-                c = '%';
+        auto tagMonitor = tagToMonitor.find(tag);
+        if (tagMonitor != tagToMonitor.end()) {
+            if (tagMonitor->second == monitorIndex) {
+                c = '+';
+                if (monitorIndex == focusedMonitor) {
+                    c = '#';
+                }
+            } else {
+                c = '-';
+                if (tagMonitor->second == focusedMonitor) {
+                    c = '%';
+                }
             }
         }
-        if (tag->flags & TAG_FLAG_URGENT) {
+        if (flags & TAG_FLAG_URGENT) {
             c = '!';
         }
-        output << c;
-        output << *tag->name;
-        output << '\t';
+        status << c;
+        status << tag->name();
+        status << '\t';
     }
+    cache.tagGeneration = tag_status_generation();
+    cache.focusedMonitor = focusedMonitor;
+    cache.monitorTags = monitorTags;
+    cache.status = status.str();
+    output << cache.status;
 }
 
 int GlobalCommands::focusEdgeCommand(Input input, Output output)
@@ -1,9 +1,13 @@
 #ifndef GLOBALCOMMANDS_H
 #define GLOBALCOMMANDS_H
 
+#include <string>
+#include <vector>
+
 #include "commandio.h"
 
 class Client;
+class HSTag;
 class Monitor;
 class Root;
 
@@ -49,6 +53,18 @@ public:
     void listClientsCommand(CallOrComplete invoc);
 private:
     Root& root_;
+
+    /** the tag_status output for a monitor together with the
+     * state it was computed from
+     */
+    struct TagStatusCache {
+        unsigned long tagGeneration = 0;
+        std::vector<HSTag*> monitorTags; //! the tag of every monitor
+        unsigned long focusedMonitor = 0;
+        std::string status;
+    };
+    //! the tag_status outputs, indexed by the monitor index
+    std::vector<TagStatusCache> tagStatusCache_;
 };
 
 #endif // GLOBALCOMMANDS_H
@@ -3,6 +3,7 @@
 #include <cassert>
 #include <cstdio>
 
+#include "freezer.h"
 #include "globals.h"
 #include "ipc-server.h"
 #include "root.h"
@@ -12,6 +13,11 @@ using std::string;
 using std::vector;
 
 void hook_emit(vector<string> args) {
+    Freezer* freezer = Freezer::ifFrozen();
+    if (freezer) {
+        freezer->deferHook(args);
+        return;
+    }
     Root::get()->ipcServer_.emitHook(args);
 }
 
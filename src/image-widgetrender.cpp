@@ -0,0 +1,170 @@
+#include "image-widgetrender.h"
+
+#include <X11/Xft/Xft.h>
+#include <algorithm>
+
+#include "fontdata.h"
+#include "utils.h"
+
+using std::max;
+using std::min;
+using std::string;
+
+ImageWidgetRender::ImageWidgetRender(Settings& settings, Rectangle area)
+    : WidgetRender(settings, area.tl())
+    , width_(max(0, area.width))
+    , height_(max(0, area.height))
+    , data_(static_cast<size_t>(width_) * static_cast<size_t>(height_), 0)
+{
+}
+
+uint32_t ImageWidgetRender::pixel(int x, int y) const
+{
+    return data_[static_cast<size_t>(y) * width_ + x];
+}
+
+/**
+ * @brief convert a color to premultiplied ARGB32, analogous to
+ * XConnection::allocColor() for 32bit visuals
+ */
+uint32_t ImageWidgetRender::premultiplied(const Color& color)
+{
+    uint32_t alpha = color.alpha_ & 0xff;
+    uint32_t red = ((color.red_ >> 8) * alpha) / 0xff;
+    uint32_t green = ((color.green_ >> 8) * alpha) / 0xff;
+    uint32_t blue = ((color.blue_ >> 8) * alpha) / 0xff;
+    return (alpha << 24) | (red << 16) | (green << 8) | blue;
+}
+
+/**
+ * @brief draw the given premultiplied color over the pixel at (x,y)
+ * @param coverage the portion of the pixel covered, from 0 to 0xff
+ */
+void ImageWidgetRender::blendPixel(int x, int y, uint32_t color, unsigned int coverage)
+{
+    if (x < 0 || y < 0 || x >= width_ || y >= height_ || coverage == 0) {
+        return;
+    }
+    uint32_t& dest = data_[static_cast<size_t>(y) * width_ + x];
+    uint32_t srcAlpha = ((color >> 24) * coverage) / 0xff;
+    uint32_t result = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint32_t src = (((color >> shift) & 0xff) * coverage) / 0xff;
+        uint32_t dst = (dest >> shift) & 0xff;
+        uint32_t channel = src + (dst * (0xff - srcAlpha)) / 0xff;
+        result |= min(channel, 0xffu) << shift;
+    }
+    dest = result;
+}
+
+void ImageWidgetRender::fillRectangle(Rectangle rect, const Color& color)
+{
+    // like XFillRectangle, this replaces the pixels and does not blend
+    int x1 = max(0, rect.x);
+    int y1 = max(0, rect.y);
+    int x2 = min(width_, rect.x + rect.width);
+    int y2 = min(height_, rect.y + rect.height);
+    uint32_t value = premultiplied(color);
+    for (int y = y1; y < y2; y++) {
+        auto row = data_.begin() + static_cast<size_t>(y) * width_;
+        std::fill(row + x1, row + x2, value);
+    }
+}
+
+void ImageWidgetRender::fillTriangle(Point2D p1, Point2D p2, Point2D p3, const Color& color)
+{
+    // a pixel is filled if its center lies within the triangle. For exact
+    // integer arithmetic, all coordinates are doubled, such that the
+    // pixel center of (x,y) is (2x+1, 2y+1)
+    auto edge = [](Point2D a, Point2D b, int px, int py) {
+        return (2 * b.x - 2 * a.x) * (py - 2 * a.y)
+                - (2 * b.y - 2 * a.y) * (px - 2 * a.x);
+    };
+    int area = edge(p1, p2, 2 * p3.x, 2 * p3.y);
+    if (area == 0) {
+        return;
+    }
+    int x1 = max(0, min({p1.x, p2.x, p3.x}));
+    int y1 = max(0, min({p1.y, p2.y, p3.y}));
+    int x2 = min(width_, max({p1.x, p2.x, p3.x}));
+    int y2 = min(height_, max({p1.y, p2.y, p3.y}));
+    uint32_t value = premultiplied(color);
+    for (int y = y1; y < y2; y++) {
+        for (int x = x1; x < x2; x++) {
+            int px = 2 * x + 1;
+            int py = 2 * y + 1;
+            int e1 = edge(p1, p2, px, py);
+            int e2 = edge(p2, p3, px, py);
+            int e3 = edge(p3, p1, px, py);
+            if (area > 0 ? (e1 >= 0 && e2 >= 0 && e3 >= 0)
+                         : (e1 <= 0 && e2 <= 0 && e3 <= 0))
+            {
+                data_[static_cast<size_t>(y) * width_ + x] = value;
+            }
+        }
+    }
+}
+
+void ImageWidgetRender::drawString(const FontData& fontData, const Color& color,
+                                   Point2D position, const string& text, size_t len)
+{
+    if (!fontData.xftFont_) {
+        // core X fonts can not be rasterized on the client side
+        return;
+    }
+    FT_Face face = XftLockFace(fontData.xftFont_);
+    if (!face) {
+        return;
+    }
+    // as in the X11 backend, the text is drawn fully opaque
+    Color opaque = color;
+    opaque.alpha_ = 0xff;
+    uint32_t value = premultiplied(opaque);
+    len = min(len, text.size());
+    int penX = position.x;
+    size_t i = 0;
+    while (i < len) {
+        // decode the next utf8 character
+        unsigned char lead = static_cast<unsigned char>(text[i++]);
+        FT_ULong codepoint = lead;
+        int continuationBytes = 0;
+        if (lead >= 0xf0) {
+            codepoint = lead & 0x07;
+            continuationBytes = 3;
+        } else if (lead >= 0xe0) {
+            codepoint = lead & 0x0f;
+            continuationBytes = 2;
+        } else if (lead >= 0xc0) {
+            codepoint = lead & 0x1f;
+            continuationBytes = 1;
+        }
+        for (; continuationBytes > 0 && i < len
+               && utf8_is_continuation_byte(text[i]); continuationBytes--) {
+            codepoint = (codepoint << 6) | (text[i++] & 0x3f);
+        }
+        FT_UInt glyphIndex = FT_Get_Char_Index(face, codepoint);
+        if (FT_Load_Glyph(face, glyphIndex, FT_LOAD_RENDER)) {
+            continue;
+        }
+        FT_GlyphSlot glyph = face->glyph;
+        const FT_Bitmap& bitmap = glyph->bitmap;
+        int left = penX + glyph->bitmap_left;
+        int top = position.y - glyph->bitmap_top;
+        for (unsigned int row = 0; row < bitmap.rows; row++) {
+            const unsigned char* line = bitmap.buffer + row * bitmap.pitch;
+            for (unsigned int col = 0; col < bitmap.width; col++) {
+                unsigned int coverage;
+                if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO) {
+                    coverage = (line[col / 8] & (0x80 >> (col % 8))) ? 0xff : 0;
+                } else {
+                    coverage = line[col];
+                }
+                blendPixel(left + static_cast<int>(col),
+                           top + static_cast<int>(row),
+                           value, coverage);
+            }
+        }
+        penX += static_cast<int>(glyph->advance.x >> 6);
+    }
+    XftUnlockFace(fontData.xftFont_);
+}
@@ -0,0 +1,41 @@
+#ifndef IMAGEWIDGETRENDER_H
+#define IMAGEWIDGETRENDER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "widgetrender.h"
+
+/**
+ * @brief Render widgets into a client side image buffer, without
+ * any round trip to the X server. The pixels are stored row by row
+ * as premultiplied ARGB32 (0xAARRGGBB), i.e. in the format
+ * of 32bit visuals, such that the buffer can be uploaded
+ * to the X server in one go.
+ *
+ * Text is only rendered for xft fonts, because core X fonts
+ * can only be drawn by the X server.
+ */
+class ImageWidgetRender : public WidgetRender
+{
+public:
+    //! render the given area of the widget coordinate system
+    ImageWidgetRender(Settings& settings, Rectangle area);
+    int width() const { return width_; }
+    int height() const { return height_; }
+    uint32_t pixel(int x, int y) const;
+    const std::vector<uint32_t>& data() const { return data_; }
+protected:
+    void fillRectangle(Rectangle rect, const Color& color) override;
+    void fillTriangle(Point2D p1, Point2D p2, Point2D p3, const Color& color) override;
+    void drawString(const FontData& fontData, const Color& color,
+                    Point2D position, const std::string& text, size_t len) override;
+private:
+    static uint32_t premultiplied(const Color& color);
+    void blendPixel(int x, int y, uint32_t color, unsigned int coverage);
+    int width_;
+    int height_;
+    std::vector<uint32_t> data_;
+};
+
+#endif // IMAGEWIDGETRENDER_H
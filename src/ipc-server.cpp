@@ -50,7 +50,9 @@ bool IpcServer::handleConnection(Window win, CallHandler callback) {
         // executed (e.g. after being called by ipc_add_connection())
         return false;
     }
+    currentConnection_ = win;
     auto result = callback(maybeArguments.value());
+    currentConnection_ = 0;
     // send output back
     // here, it is important to use 'long' because XChangeProperty() requires
     // data of type long.
@@ -34,12 +34,15 @@ public:
     bool handleConnection(Window window, CallHandler callback);
     //! send a hook to all listening clients
     void emitHook(std::vector<std::string> args);
+    //! the ipc client window whose request is handled currently, or 0
+    Window currentConnection() const { return currentConnection_; }
 
 private:
     XConnection& X;
 
     Window hookEventWindow_; //! window on which the hooks are announced
     int nextHookNumber_; //! index for the next hook
+    Window currentConnection_ = 0;
 };
 
 #endif
@@ -5,6 +5,7 @@
 #include <sstream> // IWYU pragma: keep
 #include <stdexcept>
 
+#include "arglist.h"
 #include "completion.h"
 #include "globals.h"
 #include "utils.h"
@@ -244,3 +245,47 @@ template<> void Converter<KeyCombo>::complete(Completion& complete, KeyCombo con
 template<> string Converter<KeyCombo>::str(KeyCombo payload) {
     return payload.str();
 }
+
+string KeySequence::str() const
+{
+    string result;
+    for (const auto& combo : combos) {
+        if (!result.empty()) {
+            result += KeySequence::separator;
+        }
+        result += combo.str();
+    }
+    return result;
+}
+
+/*!
+ * Creates a KeySequence from its string representation, i.e. the
+ * key combos separated by spaces.
+ *
+ * Example inputs: "Mod1-i", "Mod1-i 1", "Mod4-x Shift-a b"
+ *
+ * \throws meaningful exceptions on parsing errors
+ */
+template<> KeySequence Converter<KeySequence>::parse(const string& source) {
+    KeySequence sequence;
+    for (const auto& token : ArgList::split(source, KeySequence::separator)) {
+        if (token.empty()) {
+            // allow multiple spaces between the key combos
+            continue;
+        }
+        sequence.combos.push_back(Converter<KeyCombo>::parse(token));
+    }
+    if (sequence.combos.empty()) {
+        throw std::invalid_argument("Must not be empty");
+    }
+    return sequence;
+}
+
+template<> string Converter<KeySequence>::str(KeySequence payload) {
+    return payload.str();
+}
+
+template<> void Converter<KeySequence>::complete(Completion& complete, KeySequence const*) {
+    // only the first key combo of a sequence is completed
+    Converter<KeyCombo>::complete(complete, nullptr);
+}
@@ -84,3 +84,29 @@ public:
 };
 
 ConverterInstance(KeyCombo)
+
+/*!
+ * A sequence of key combos that have to be pressed one after another,
+ * e.g. "Mod1-i 1". A sequence of more than one key combo is a key chord.
+ */
+class KeySequence {
+public:
+    static constexpr char separator = ' ';
+
+    std::string str() const;
+
+    std::vector<KeyCombo> combos;
+};
+
+ConverterInstance(KeySequence)
+
+namespace std {
+    template<>
+    struct hash<KeyCombo> {
+        size_t operator()(const KeyCombo& combo) const {
+            size_t h = hash<KeySym>()(combo.keysym);
+            h = h * 31 + combo.modifiers_;
+            return h * 2 + (combo.onRelease_ ? 1 : 0);
+        }
+    };
+}
@@ -1,6 +1,8 @@
 #include "keymanager.h"
 
+#include <X11/Xutil.h>
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -15,71 +17,125 @@
 #include "ipc-protocol.h"
 #include "keycombo.h"
 #include "root.h"
+#include "settings.h"
 #include "utils.h"
 
 using std::endl;
+using std::pair;
 using std::string;
 using std::unique_ptr;
+using std::vector;
+
+KeyManager::KeyManager()
+    : discardedOutput_(nullptr)
+    , keyChordTimeout_([this]() { cancelKeyChord(); })
+{
+}
 
 KeyManager::~KeyManager() {
 }
 
 void KeyManager::keybindCommand(CallOrComplete invoc)
 {
-    KeyCombo key;
+    KeySequence keys;
     ArgParse ap;
-    ap.mandatory(key);
+    ap.mandatory(keys);
     ap.command(invoc,
                [&](Completion& complete) { complete.completeCommands(0); },
                [&](ArgList command, Output output) -> int {
         if (command.empty()) {
             return  HERBST_NEED_MORE_ARGS;
         }
-        KeyBinding keybind;
-        keybind.keyCombo = key;
-        keybind.cmd = { command.begin(), command.end() };
-        return addKeybind(keybind, output);
+        return addKeybind(keys, { command.begin(), command.end() }, output);
     });
 }
 
-int KeyManager::addKeybind(KeyBinding newBinding, Output output) {
-    // newBinding->cmd is not empty because the size before the input.shift() was >= 2
-    if (!Commands::commandExists(newBinding.cmd[0])) {
+/*!
+ * Binds the given command to the key sequence. If the sequence consists
+ * of multiple key combos, then the command is bound to the key chord.
+ * An existing binding for the same sequence or for a prefix of the sequence
+ * is overwritten.
+ */
+int KeyManager::addKeybind(const KeySequence& keys, const vector<string>& cmd, Output output) {
+    // cmd is not empty because the size before the input.shift() was >= 2
+    if (!Commands::commandExists(cmd[0])) {
         output.perror() << "the command \""
-               << newBinding.cmd[0] << "\" does not exist."
+               << cmd[0] << "\" does not exist."
                << " Did you forget \"spawn\"?\n";
         return HERBST_COMMAND_NOT_FOUND;
     }
+    // the pending chord might be modified or removed
+    cancelKeyChord();
+
+    const KeyCombo& first = keys.combos.front();
+    auto existing = bindsByCombo_.find(first);
+    KeyBinding* node = nullptr;
+    if (keys.combos.size() > 1
+        && existing != bindsByCombo_.end()
+        && existing->second->isChordPrefix())
+    {
+        // add the chord to the existing chord prefix
+        node = existing->second;
+    } else {
+        node = addTopLevelBinding(first);
+    }
+    for (auto it = keys.combos.begin() + 1; it != keys.combos.end(); it++) {
+        bool isLast = (it + 1 == keys.combos.end());
+        KeyBinding* next = node->findContinuation(*it);
+        if (!next || isLast || !next->isChordPrefix()) {
+            node->removeContinuation(*it);
+            node->chordContinuations.push_back(make_unique<KeyBinding>());
+            next = node->chordContinuations.back().get();
+            next->keyCombo = *it;
+        }
+        node = next;
+    }
+    node->cmd = std::make_shared<const vector<string>>(cmd);
+
+    ensureKeyMask();
+    keyComboBatchFinished.emit();
+
+    return HERBST_EXIT_SUCCESS;
+}
 
+/*!
+ * Adds an empty binding for the given combo to the list of bindings,
+ * replacing any existing binding for it.
+ */
+KeyManager::KeyBinding* KeyManager::addTopLevelBinding(const KeyCombo& combo) {
     // Make sure there is no existing binding with same keysym/modifiers
     bool alreadyActive = false;
-    removeKeyBinding(newBinding.keyCombo, &alreadyActive);
+    removeKeyBinding(combo, &alreadyActive);
 
-    if (currentKeyMask_.allowsBinding(newBinding.keyCombo)
-        && currentKeysInactive_.allowsBinding(newBinding.keyCombo))
+    auto ptr = make_unique<KeyBinding>();
+    ptr->keyCombo = combo;
+    if (currentKeyMask_.allowsBinding(combo)
+        && currentKeysInactive_.allowsBinding(combo))
     {
         // Grab for events on this keycode
-        newBinding.grabbed = true;
+        ptr->grabbed = true;
         if (!alreadyActive) {
-            keyComboActive.emit(newBinding.keyCombo);
+            keyComboActive.emit(combo);
         }
     }
 
     // Add keybinding to list
-    auto ptr = make_unique<KeyBinding>(newBinding);
+    KeyBinding* binding = ptr.get();
+    bindsByCombo_[combo] = binding;
     binds.push_back(std::move(ptr));
-
-    ensureKeyMask();
-
-    return HERBST_EXIT_SUCCESS;
+    return binding;
 }
 
 int KeyManager::listKeybindsCommand(Output output) const {
+    vector<pair<string, const KeyBinding*>> leaves;
     for (auto& binding : binds) {
+        binding->listLeaves("", leaves);
+    }
+    for (const auto& leaf : leaves) {
         // add key combo
-        output << binding->keyCombo.str();
+        output << leaf.first;
         // add associated command
-        output << "\t" << ArgList(binding->cmd).join('\t');
+        output << "\t" << ArgList(leaf.second->cmd).join('\t');
         output << "\n";
     }
     return 0;
@@ -91,23 +147,30 @@ int KeyManager::removeKeybindCommand(Input input, Output output) {
         return HERBST_NEED_MORE_ARGS;
     }
 
+    cancelKeyChord();
     if (arg == "--all" || arg == "-F") {
+        bindsByCombo_.clear();
         binds.clear();
         keyComboAllInactive.emit();
     } else {
-        KeyCombo comboToRemove = {};
+        KeySequence keysToRemove;
         try {
-            comboToRemove = Converter<KeyCombo>::parse(arg);
+            keysToRemove = Converter<KeySequence>::parse(arg);
         } catch (std::exception &error) {
             output.perror() << arg << ": " << error.what() << "\n";
             return HERBST_INVALID_ARGUMENT;
         }
+        if (keysToRemove.combos.size() > 1) {
+            return removeKeyChord(keysToRemove, output);
+        }
+        KeyCombo comboToRemove = keysToRemove.combos.front();
 
         // Remove binding (or moan if none was found)
         bool wasActive = false;
         if (removeKeyBinding(comboToRemove, &wasActive)) {
             if (wasActive) {
                 keyComboInactive.emit(comboToRemove);
+                keyComboBatchFinished.emit();
             }
         } else {
             output.perror() << "Key \"" << arg << "\" is not bound\n";
@@ -118,31 +181,146 @@ int KeyManager::removeKeybindCommand(Input input, Output output) {
     return HERBST_EXIT_SUCCESS;
 }
 
+/*!
+ * Removes the binding of the given key chord (with all chords it is a
+ * prefix of). Chord prefixes that have no continuations anymore are
+ * removed as well.
+ */
+int KeyManager::removeKeyChord(const KeySequence& chord, Output output) {
+    // the bindings along the chord
+    vector<KeyBinding*> path;
+    auto top = bindsByCombo_.find(chord.combos.front());
+    if (top != bindsByCombo_.end()) {
+        path.push_back(top->second);
+        for (auto it = chord.combos.begin() + 1; it != chord.combos.end(); it++) {
+            KeyBinding* next = path.back()->findContinuation(*it);
+            if (!next) {
+                break;
+            }
+            path.push_back(next);
+        }
+    }
+    if (path.size() != chord.combos.size()) {
+        output.perror() << "Key \"" << chord.str() << "\" is not bound\n";
+        return HERBST_INVALID_ARGUMENT;
+    }
+    // remove the binding and all prefixes that become empty
+    size_t depth = path.size() - 1;
+    do {
+        path[depth - 1]->removeContinuation(path[depth]->keyCombo);
+        depth--;
+    } while (depth > 0 && !path[depth]->isChordPrefix());
+    if (depth == 0 && !path[0]->isChordPrefix()) {
+        bool wasActive = false;
+        KeyCombo comboToRemove = path[0]->keyCombo;
+        removeKeyBinding(comboToRemove, &wasActive);
+        if (wasActive) {
+            keyComboInactive.emit(comboToRemove);
+            keyComboBatchFinished.emit();
+        }
+    }
+    return HERBST_EXIT_SUCCESS;
+}
+
 void KeyManager::removeKeybindCompletion(Completion &complete) {
     if (complete == 0) {
         complete.full({ "-F", "--all" });
 
+        vector<pair<string, const KeyBinding*>> leaves;
         for (auto& binding : binds) {
-            complete.full(binding->keyCombo.str());
+            binding->listLeaves("", leaves);
+        }
+        for (const auto& leaf : leaves) {
+            complete.full(leaf.first);
         }
     }
 }
 
 void KeyManager::handleKeyComboEvent(KeyCombo combo) {
+    if (pendingChord_) {
+        continueKeyChord(combo);
+        return;
+    }
+    auto found = bindsByCombo_.find(combo);
+    if (found == bindsByCombo_.end()) {
+        return;
+    }
+    KeyBinding& binding = *(found->second);
+    if (binding.isChordPrefix()) {
+        startKeyChord(&binding);
+        return;
+    }
+    executeBinding(binding);
+}
 
-    auto found = std::find_if(binds.begin(), binds.end(),
-            [=](const unique_ptr<KeyBinding> &other) {
-                return combo == other->keyCombo;
-            });
-    if (found != binds.end()) {
-        // execute the bound command
-        std::ostringstream discardedOutput;
-        auto& cmd = (*found)->cmd;
-        Input input(cmd.front(), {cmd.begin() + 1, cmd.end()});
-        // discard output, but forward errors to std::cerr
-        OutputChannels channels(cmd.front(), discardedOutput, std::cerr);
-        Commands::call(input, channels);
+//! Handle a key event while a key chord is pending
+void KeyManager::continueKeyChord(const KeyCombo& combo) {
+    KeyBinding* next = pendingChord_->findContinuation(combo);
+    if (!next) {
+        if (combo.onRelease_ || IsModifierKey(combo.keysym)) {
+            // releasing the keys of the previous step or pressing the
+            // modifiers for the next step does not abort the chord
+            return;
+        }
+        // any other key aborts the chord
+        cancelKeyChord();
+        return;
+    }
+    if (next->isChordPrefix()) {
+        startKeyChord(next);
+        return;
+    }
+    cancelKeyChord();
+    executeBinding(*next);
+}
+
+/*!
+ * Wait for the next key of a key chord. While a chord is pending, the
+ * entire keyboard is grabbed.
+ */
+void KeyManager::startKeyChord(KeyBinding* prefix) {
+    bool wasPending = pendingChord_ != nullptr;
+    pendingChord_ = prefix;
+    if (!wasPending) {
+        keyChordStarted.emit();
+    }
+    int timeout = Root::get()->settings()->keychord_timeout();
+    if (timeout > 0) {
+        keyChordTimeout_.start(std::chrono::milliseconds(timeout));
+    } else {
+        keyChordTimeout_.stop();
+    }
+}
+
+//! Abort the pending key chord, if there is any
+void KeyManager::cancelKeyChord() {
+    if (!pendingChord_) {
+        return;
+    }
+    pendingChord_ = nullptr;
+    keyChordTimeout_.stop();
+    keyChordFinished.emit();
+}
+
+void KeyManager::executeBinding(KeyBinding& binding) {
+    if (!binding.command
+        || binding.commandTableGeneration != Commands::generation())
+    {
+        binding.command = Commands::find(binding.cmd->front());
+        binding.commandTableGeneration = Commands::generation();
+    }
+    if (!binding.command) {
+        std::cerr << "error: Command \"" << binding.cmd->front() << "\" not found" << endl;
+        return;
     }
+    // execute the bound command. The binding might be removed by the
+    // command itself, so only 'input' (which shares the ownership of the
+    // arguments) is used from now on.
+    const CommandBinding* command = binding.command;
+    Input input(binding.cmd);
+    // discard output, but forward errors to std::cerr
+    OutputChannels channels(input.command(), discardedOutput_, std::cerr);
+    (*command)(input, channels);
 }
 
 /*!
@@ -194,6 +372,7 @@ void KeyManager::setActiveKeyMask(const KeyMask& keyMask, const KeyMask& keysIna
     }
     currentKeyMask_ = keyMask;
     currentKeysInactive_ = keysInactive;
+    keyComboBatchFinished.emit();
 }
 
 //! Set the current key filters to an empty exception
@@ -209,14 +388,8 @@ void KeyManager::clearActiveKeyMask() {
  */
 bool KeyManager::removeKeyBinding(const KeyCombo& comboToRemove, bool* wasActive) {
     // Find binding to remove
-    auto removeIter = binds.begin();
-    for (; removeIter != binds.end(); removeIter++) {
-        if (comboToRemove == (*removeIter)->keyCombo) {
-            break;
-        }
-    }
-
-    if (removeIter == binds.end()) {
+    auto indexed = bindsByCombo_.find(comboToRemove);
+    if (indexed == bindsByCombo_.end()) {
         if (wasActive) {
             *wasActive = false;
         }
@@ -225,9 +398,14 @@ bool KeyManager::removeKeyBinding(const KeyCombo& comboToRemove, bool* wasActive
 
     // Remove binding
     if (wasActive) {
-        *wasActive = (*removeIter)->grabbed;
+        *wasActive = indexed->second->grabbed;
     }
-    binds.erase(removeIter);
+    KeyBinding* toRemove = indexed->second;
+    bindsByCombo_.erase(indexed);
+    binds.erase(std::remove_if(binds.begin(), binds.end(),
+            [=](const unique_ptr<KeyBinding> &other) {
+                return other.get() == toRemove;
+            }), binds.end());
     return True;
 }
 
@@ -267,3 +445,44 @@ bool KeyManager::KeyMask::allowsBinding(const KeyCombo &combo) const
         }
     }
 }
+
+KeyManager::KeyBinding* KeyManager::KeyBinding::findContinuation(const KeyCombo& combo) const
+{
+    for (const auto& continuation : chordContinuations) {
+        if (continuation->keyCombo == combo) {
+            return continuation.get();
+        }
+    }
+    return nullptr;
+}
+
+void KeyManager::KeyBinding::removeContinuation(KeyCombo combo)
+{
+    chordContinuations.erase(
+        std::remove_if(chordContinuations.begin(), chordContinuations.end(),
+            [&](const unique_ptr<KeyBinding>& continuation) {
+                return continuation->keyCombo == combo;
+            }),
+        chordContinuations.end());
+}
+
+/*!
+ * Collect all bindings with a command in the subtree of this binding,
+ * together with their full key sequence.
+ */
+void KeyManager::KeyBinding::listLeaves(const string& prefix,
+                                        vector<pair<string, const KeyBinding*>>& leaves) const
+{
+    string keys = prefix;
+    if (!keys.empty()) {
+        keys += KeySequence::separator;
+    }
+    keys += keyCombo.str();
+    if (!isChordPrefix()) {
+        leaves.push_back({keys, this});
+        return;
+    }
+    for (const auto& continuation : chordContinuations) {
+        continuation->listLeaves(keys, leaves);
+    }
+}
@@ -1,15 +1,20 @@
 #pragma once
 
 #include <memory>
+#include <ostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "commandio.h"
 #include "keycombo.h"
 #include "object.h"
 #include "regexstr.h"
+#include "timeout.h"
 
 class Client;
+class CommandBinding;
 class Completion;
 
 /*!
@@ -57,12 +62,29 @@ private:
     class KeyBinding {
     public:
         KeyCombo keyCombo;
-        std::vector<std::string> cmd;
+        //! the command and its arguments, shared with the Input on execution
+        std::shared_ptr<const std::vector<std::string>> cmd;
         bool grabbed = false;
+        /*! the binding of the command (*cmd)[0], resolved on the first
+         * keypress. It is only valid as long as commandTableGeneration
+         * equals Commands::generation().
+         */
+        const CommandBinding* command = nullptr;
+        unsigned long commandTableGeneration = 0;
+        /*! if this binding is the prefix of key chords, then these are the
+         * bindings for the next key of the chord and cmd is not set.
+         */
+        std::vector<std::unique_ptr<KeyBinding>> chordContinuations;
+
+        bool isChordPrefix() const { return !chordContinuations.empty(); }
+        KeyBinding* findContinuation(const KeyCombo& combo) const;
+        void removeContinuation(KeyCombo combo);
+        void listLeaves(const std::string& prefix,
+                        std::vector<std::pair<std::string, const KeyBinding*>>& leaves) const;
     };
 
 public:
-    KeyManager() = default;
+    KeyManager();
     ~KeyManager();
 
     //! emitted whenever a keycombo changes from inactive to active
@@ -71,9 +93,15 @@ public:
     Signal_<KeyCombo> keyComboInactive;
     //! emitted when all keycombos become inactive
     Signal keyComboAllInactive;
+    //! emitted after a batch of keyComboActive/keyComboInactive signals
+    Signal keyComboBatchFinished;
+    //! emitted when the first key of a key chord was pressed
+    Signal keyChordStarted;
+    //! emitted when a key chord was completed or aborted
+    Signal keyChordFinished;
 
     void keybindCommand(CallOrComplete invoc);
-    int addKeybind(KeyBinding newBinding, Output output);
+    int addKeybind(const KeySequence& keys, const std::vector<std::string>& cmd, Output output);
     int listKeybindsCommand(Output output) const;
     int removeKeybindCommand(Input input, Output output);
 
@@ -86,10 +114,26 @@ public:
     void clearActiveKeyMask();
 
 private:
+    KeyBinding* addTopLevelBinding(const KeyCombo& combo);
     bool removeKeyBinding(const KeyCombo& comboToRemove, bool* wasActive = nullptr);
+    int removeKeyChord(const KeySequence& chord, Output output);
+    void executeBinding(KeyBinding& binding);
+    void continueKeyChord(const KeyCombo& combo);
+    void startKeyChord(KeyBinding* prefix);
+    void cancelKeyChord();
 
     //! Currently defined keybindings
     std::vector<std::unique_ptr<KeyBinding>> binds;
+    //! The entries of 'binds', indexed by their key combo
+    std::unordered_map<KeyCombo, KeyBinding*> bindsByCombo_;
+
+    //! stream without buffer that discards the output of bound commands
+    std::ostream discardedOutput_;
+
+    //! the key chord prefix entered so far, or nullptr if there is none
+    KeyBinding* pendingChord_ = nullptr;
+    //! aborts the pending key chord after 'keychord_timeout'
+    Timeout keyChordTimeout_;
 
     // The last applies KeyMask & KeysInactive(for comparison on change)
     KeyMask currentKeyMask_;
@@ -68,8 +68,8 @@ FrameSplit::FrameSplit(HSTag* tag, Settings* settings, weak_ptr<FrameSplit> pare
              , splitTypeAttr_(this, "split_type", &FrameSplit::getAlign, &FrameSplit::userSetsSplitType)
              , fractionAttr_(this, "fraction", &FrameSplit::getFraction, &FrameSplit::userSetsFraction)
              , selectionAttr_(this, "selection", &FrameSplit::getSelection, &FrameSplit::userSetsSelection)
-             , aLink_(*this, "0")
-             , bLink_(*this, "1")
+             , aLink_(*this, "0", true)
+             , bLink_(*this, "1", true)
 {
     this->align_ = align;
     selection_ = 0;
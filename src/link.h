@@ -7,14 +7,17 @@
 
 /*! A pointer to another object in the object tree. if this is
  * assigned a new value, then the child object in the owner is updated
- * automatically.
+ * automatically. If the link is 'owning', then the owner becomes the
+ * parent of the object, otherwise the object is only referenced and
+ * remains at its original place in the object tree.
  */
 template<typename T>
 class Link_ : public ChildEntry {
 public:
     // 'name' is the name of the child pointer
-    Link_(Object& parent, std::string name)
+    Link_(Object& parent, std::string name, bool owning = false)
         : ChildEntry(parent, name)
+        , owning_(owning)
     { }
     void operator=(T* new_value) {
         if (new_value == pointer) {
@@ -22,8 +25,10 @@ public:
             return;
         }
         pointer = new_value;
-        if (pointer) {
+        if (pointer && owning_) {
             owner_.addChild(pointer, name_);
+        } else if (pointer) {
+            owner_.addChildReference(pointer, name_);
         } else {
             owner_.removeChild(name_);
         }
@@ -39,6 +44,7 @@ public:
 private:
     Signal_<T*> changed_;
     T* pointer = nullptr;
+    bool owning_;
 };
 
 #endif
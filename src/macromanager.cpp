@@ -0,0 +1,234 @@
+#include "macromanager.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "argparse.h"
+#include "command.h"
+#include "completion.h"
+#include "ipc-protocol.h"
+#include "storedcommand.h"
+#include "utils.h"
+
+using std::make_shared;
+using std::pair;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+//! the maximum number of nested macro calls, e.g. if a macro calls itself
+static const int maxCallDepth = 64;
+
+class Macro : public StoredCommand {
+public:
+    Macro(const vector<string>& parameters, shared_ptr<const ArgList::Container> command)
+        : StoredCommand(command)
+        , parameters_(this, "parameters", &Macro::getParameters)
+        , callCount_(this, "call_count", &Macro::getCallCount)
+        , parameterNames_(parameters)
+    {
+        setDoc("a macro defined via the 'macro define' command");
+        parameters_.setDoc("the names of the parameters, separated by spaces");
+        callCount_.setDoc("the number of times the macro was called");
+        // find the tokens that need to be replaced on every call
+        for (size_t i = 0; i < argv_->size(); i++) {
+            for (size_t p = 0; p < parameterNames_.size(); p++) {
+                if ((*argv_)[i] == parameterNames_[p]) {
+                    parameterPositions_.push_back({i, p});
+                    break;
+                }
+            }
+        }
+    }
+    DynAttribute_<string> parameters_;
+    DynAttribute_<unsigned long> callCount_;
+
+    size_t parameterCount() const { return parameterNames_.size(); }
+
+    /**
+     * @brief the input for calling the macro's command with the
+     * given values for the parameters. The stored command is only copied
+     * if there are parameters.
+     */
+    Input instantiate(const vector<string>& values) {
+        callCount++;
+        if (parameterPositions_.empty()) {
+            return input();
+        }
+        auto argv = make_shared<ArgList::Container>(*argv_);
+        for (const auto& position : parameterPositions_) {
+            (*argv)[position.first] = values[position.second];
+        }
+        return Input(argv);
+    }
+private:
+    string getParameters() { return join_strings(parameterNames_, " "); }
+    unsigned long getCallCount() { return callCount; }
+
+    vector<string> parameterNames_;
+    //! pairs of token index in argv_ and parameter index
+    vector<pair<size_t, size_t>> parameterPositions_;
+    unsigned long callCount = 0;
+};
+
+MacroManager::MacroManager()
+    : count_(this, "count", &MacroManager::count)
+{
+    setDoc("For every macro, there is an entry with its name.");
+    count_.setDoc("the number of macros");
+}
+
+MacroManager::~MacroManager()
+{
+    for (auto& it : macros_) {
+        removeChild(it.first);
+    }
+}
+
+template<>
+Finite<MacroManager::Subcommand>::ValueList Finite<MacroManager::Subcommand>::values = ValueListPlain {
+    { MacroManager::Subcommand::Define, "define" },
+    { MacroManager::Subcommand::Call, "call" },
+    { MacroManager::Subcommand::Remove, "remove" },
+};
+
+int MacroManager::macroCommand(Input input, Output output)
+{
+    Subcommand subcommand = Subcommand::Define;
+    ArgParse ap = ArgParse().mandatory(subcommand);
+    if (ap.parsingFails(input, output)) {
+        return ap.exitCode();
+    }
+    switch (subcommand) {
+        case Subcommand::Define: return defineMacro(input, output);
+        case Subcommand::Call: return callMacro(input, output);
+        case Subcommand::Remove: return removeMacro(input, output);
+    }
+    return HERBST_INVALID_ARGUMENT;
+}
+
+//! macro define NAME [PARAMETERS ...] -- COMMAND [ARGS ...]
+int MacroManager::defineMacro(Input input, Output output)
+{
+    auto separator = std::find(input.begin(), input.end(), "--");
+    if (separator == input.end()) {
+        return HERBST_NEED_MORE_ARGS;
+    }
+    // the name and the parameters are the arguments before the separator
+    Input head(input.command(), input.begin(), separator);
+    string name;
+    ArgParse ap = ArgParse().mandatory(name);
+    if (ap.parsingFails(head, output)) {
+        return ap.exitCode();
+    }
+    int status = StoredCommand::checkName(name, "macro", output);
+    if (status != 0) {
+        return status;
+    }
+    vector<string> parameters = head.toVector();
+    input.shift(std::distance(input.begin(), separator) + 1);
+    shared_ptr<const ArgList::Container> command;
+    status = StoredCommand::readCommand(input, output, command);
+    if (status != 0) {
+        return status;
+    }
+    if (macros_.find(name) != macros_.end()) {
+        removeChild(name);
+    }
+    auto& macro = macros_[name];
+    macro = make_unique<Macro>(parameters, command);
+    addChild(macro.get(), name);
+    return 0;
+}
+
+//! macro call NAME [VALUES ...]
+int MacroManager::callMacro(Input input, Output output)
+{
+    string name;
+    ArgParse ap = ArgParse().mandatory(name);
+    if (ap.parsingFails(input, output)) {
+        return ap.exitCode();
+    }
+    auto it = macros_.find(name);
+    if (it == macros_.end()) {
+        output.perror() << "no such macro: " << name << "\n";
+        return HERBST_INVALID_ARGUMENT;
+    }
+    Macro& macro = *(it->second);
+    if (input.size() < macro.parameterCount()) {
+        return HERBST_NEED_MORE_ARGS;
+    }
+    if (input.size() > macro.parameterCount()) {
+        output.perror() << "macro \"" << name << "\" expects "
+                        << macro.parameterCount() << " arguments but got "
+                        << input.size() << "\n";
+        return HERBST_INVALID_ARGUMENT;
+    }
+    if (callDepth_ >= maxCallDepth) {
+        output.perror() << "too many nested macro calls\n";
+        return HERBST_FORBIDDEN;
+    }
+    // the macro might be removed by its own command, so do not
+    // access it after creating the input
+    Input command = macro.instantiate(input.toVector());
+    callDepth_++;
+    int status = Commands::call(command, output);
+    callDepth_--;
+    return status;
+}
+
+//! macro remove NAME
+int MacroManager::removeMacro(Input input, Output output)
+{
+    string name;
+    ArgParse ap = ArgParse().mandatory(name);
+    if (ap.parsingAllFails(input, output)) {
+        return ap.exitCode();
+    }
+    auto it = macros_.find(name);
+    if (it == macros_.end()) {
+        output.perror() << "no such macro: " << name << "\n";
+        return HERBST_INVALID_ARGUMENT;
+    }
+    removeChild(name);
+    macros_.erase(it);
+    return 0;
+}
+
+void MacroManager::macroCompletion(Completion& complete)
+{
+    if (complete == 0) {
+        Converter<Subcommand>::complete(complete);
+        return;
+    }
+    const string& subcommand = complete[0];
+    if (subcommand == "define") {
+        for (size_t i = 2; i < complete.needleIndex(); i++) {
+            if (complete[i] == "--") {
+                complete.completeCommands(i + 1);
+                return;
+            }
+        }
+        if (complete > 1) {
+            complete.full("--");
+        }
+    } else if (subcommand == "call" || subcommand == "remove") {
+        if (complete == 1) {
+            for (const auto& it : macros_) {
+                complete.full(it.first);
+            }
+            return;
+        }
+        auto it = macros_.find(complete[1]);
+        if (subcommand == "remove"
+            || it == macros_.end()
+            || complete > it->second->parameterCount() + 1)
+        {
+            complete.none();
+        }
+    } else {
+        complete.none();
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "attribute_.h"
+#include "commandio.h"
+#include "finite.h"
+#include "object.h"
+
+class Completion;
+class Macro;
+
+/**
+ * @brief The MacroManager holds the user defined macros: commands that
+ * are stored under a name (with parameters that are filled in on every
+ * call) such that they can be called with a single command.
+ */
+class MacroManager : public Object {
+public:
+    enum class Subcommand {
+        Define,
+        Call,
+        Remove,
+    };
+    MacroManager();
+    ~MacroManager() override;
+    DynAttribute_<unsigned long> count_;
+
+    int macroCommand(Input input, Output output);
+    void macroCompletion(Completion& complete);
+private:
+    int defineMacro(Input input, Output output);
+    int callMacro(Input input, Output output);
+    int removeMacro(Input input, Output output);
+    unsigned long count() const { return macros_.size(); }
+
+    std::map<std::string, std::unique_ptr<Macro>> macros_;
+    //! the number of nested macro calls currently running
+    int callDepth_ = 0;
+};
+
+template <>
+struct is_finite<MacroManager::Subcommand> : std::true_type {};
+template<> Finite<MacroManager::Subcommand>::ValueList Finite<MacroManager::Subcommand>::values;
@@ -13,6 +13,7 @@
 
 #include "autostart.h"
 #include "client.h"
+#include "changejournal.h"
 #include "clientmanager.h"
 #include "command.h"
 #include "commandio.h"
@@ -21,6 +22,7 @@
 #include "font.h"
 #include "fontdata.h"
 #include "frametree.h"
+#include "freezer.h"
 #include "globalcommands.h"
 #include "globals.h"
 #include "hook.h"
@@ -28,6 +30,7 @@
 #include "ipc-server.h"
 #include "keymanager.h"
 #include "layout.h"
+#include "macromanager.h"
 #include "metacommands.h"
 #include "monitordetection.h"
 #include "monitormanager.h"
@@ -37,6 +40,7 @@
 #include "rulemanager.h"
 #include "settings.h"
 #include "tagmanager.h"
+#include "timermanager.h"
 #include "tmp.h"
 #include "utils.h"
 #include "watchers.h"
@@ -73,12 +77,16 @@ unique_ptr<CommandTable> commands(shared_ptr<Root> root) {
 
     Autostart* autostart = root->autostart();
     ClientManager* clients = root->clients();
+    ChangeJournal* journal = root->journal();
+    Freezer* freeze = root->freeze();
     KeyManager *keys = root->keys();
+    MacroManager* macros = root->macros();
     MonitorManager* monitors = root->monitors();
     MouseManager* mouse = root->mouse();
     RuleManager* rules = root->rules();
     Settings* settings = root->settings();
     TagManager* tags = root->tags();
+    TimerManager* timers = root->timers();
     Tmp* tmp = root->tmp();
     Watchers* watchers = root->watchers();
 
@@ -189,6 +197,8 @@ unique_ptr<CommandTable> commands(shared_ptr<Root> root) {
         {"complete_shell", completeCommand},
         {"lock",           { [monitors] { monitors->lock(); return 0; } }},
         {"unlock",         { [monitors] { monitors->unlock(); return 0; } }},
+        {"freeze",         { freeze, &Freezer::freezeCommand }},
+        {"thaw",           { freeze, &Freezer::thawCommand }},
         {"lock_tag",       monitors->byFirstArg(&Monitor::lock_tag_cmd, &Monitor::noComplete) },
         {"unlock_tag",     monitors->byFirstArg(&Monitor::unlock_tag_cmd, &Monitor::noComplete) },
         {"set_layout",     { tags->frameCommand(&FrameTree::setLayoutCommand, &FrameTree::setLayoutCompletion) }},
@@ -204,11 +214,16 @@ unique_ptr<CommandTable> commands(shared_ptr<Root> root) {
                                             &MetaCommands::chainCompletion}},
         {"object_tree",    { meta_commands, &MetaCommands::print_object_tree_command,
                                             &MetaCommands::print_object_tree_complete} },
+        {"dump_tree",      { meta_commands, &MetaCommands::dumpTreeCommand} },
         {"substitute",     { meta_commands, &MetaCommands::substitute_cmd,
                                             &MetaCommands::substitute_complete} },
         {"foreach",        { meta_commands, &MetaCommands::foreachCommand} },
         {"sprintf",        { meta_commands, &MetaCommands::sprintf_cmd,
                                             &MetaCommands::sprintf_complete} },
+        {"macro",          { macros, &MacroManager::macroCommand,
+                                     &MacroManager::macroCompletion} },
+        {"timer",          { timers, &TimerManager::timerCommand,
+                                     &TimerManager::timerCompletion} },
         {"new_attr",       { meta_commands, &MetaCommands::new_attr_cmd,
                                             &MetaCommands::new_attr_complete} },
         {"remove_attr",    { meta_commands, &MetaCommands::remove_attr_cmd,
@@ -233,6 +248,7 @@ unique_ptr<CommandTable> commands(shared_ptr<Root> root) {
                                             &MetaCommands::helpCompletion }},
         {"attr",           { meta_commands, &MetaCommands::attr_cmd,
                                             &MetaCommands::attr_complete }},
+        {"changes_since",  { journal, &ChangeJournal::changesSinceCommand }},
         {"watch",          { watchers, &Watchers::watchCommand,
                                        &Watchers::watchCompletion }},
         {"mktemp",         { tmp, &Tmp::mktemp,
@@ -435,7 +451,6 @@ int main(int argc, char* argv[]) {
     }
     root->monitors()->ensure_monitors_are_available();
     mainloop.scanExistingClients();
-    tag_force_update_flags();
     all_monitors_apply_layout();
     ewmh->updateAll();
     if (!root->clients->focus()) {
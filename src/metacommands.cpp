@@ -17,10 +17,13 @@
 #include "completion.h"
 #include "finite.h"
 #include "ipc-protocol.h"
+#include "objectdump.h"
 #include "regexstr.h"
+#include "utils.h"
 
 using std::endl;
 using std::function;
+using std::make_shared;
 using std::pair;
 using std::string;
 using std::stringstream;
@@ -85,6 +88,8 @@ template<> void Converter<ObjectPointer>::complete(Completion& complete, ObjectP
 }
 
 
+const size_t MetaCommands::cacheCapacity_ = 64;
+
 MetaCommands::MetaCommands(Object& root_) : root(root_) {
     ObjectPointer::root_ = &root;
 }
@@ -245,6 +250,59 @@ int MetaCommands::attrTypeCommand(Input input, Output output)
     return 0;
 }
 
+/**
+ * @brief serialize the given objects and attributes (or the
+ * entire object tree) in a machine readable format
+ */
+void MetaCommands::dumpTreeCommand(CallOrComplete invoc)
+{
+    DumpFormat format = DumpFormat::json;
+    ArgParse ap;
+    ap.flags({
+        {"--format=", format},
+    });
+    ap.command(invoc,
+               [&](Completion& complete) {
+        completeObjectPath(complete, true);
+    },
+               [&](ArgList args, Output output) -> int {
+        vector<string> paths = args.toVector();
+        if (paths.empty()) {
+            paths.push_back("");
+        }
+        // resolve all paths first such that nothing is
+        // printed if one of them is invalid
+        vector<pair<Object*, Attribute*>> entries;
+        for (string& path : paths) {
+            while (!path.empty() && *(path.rbegin()) == OBJECT_PATH_SEPARATOR) {
+                path.erase(path.size() - 1);
+            }
+            stringstream dummyOutput;
+            OutputChannels dummyChannels {"", dummyOutput, dummyOutput};
+            Object* object = root.child(Path(path, OBJECT_PATH_SEPARATOR), dummyChannels);
+            Attribute* attribute = nullptr;
+            if (!object) {
+                attribute = root.deepAttribute(path, dummyChannels);
+            }
+            if (!object && !attribute) {
+                output.perror() << "No such object or attribute: " << path << endl;
+                return HERBST_INVALID_ARGUMENT;
+            }
+            entries.push_back(std::make_pair(object, attribute));
+        }
+        ObjectDump dump(format, output.output());
+        for (size_t i = 0; i < paths.size(); i++) {
+            if (entries[i].first) {
+                dump.add(paths[i], entries[i].first);
+            } else {
+                dump.add(paths[i], entries[i].second);
+            }
+        }
+        dump.finish();
+        return 0;
+    });
+}
+
 void MetaCommands::attrTypeCompletion(Completion& complete)
 {
     if (complete == 0) {
@@ -327,11 +385,11 @@ int MetaCommands::foreachChild(string ident,
                                Input nestedCommand,
                                Output output)
 {
-    // collect the paths of all children of this object
+    // collect the paths of all children of this object before calling
+    // any command, because the commands may change (and delete) the
+    // objects. The path of a child is built from the path of its parent,
+    // so no path is resolved from the root during the traversal.
     vector<string> childPaths;
-    // collect the children's names first to ensure that
-    // object->children() is not changed by the commands we are
-    // calling.
     if (recursive) {
         // if recursive, then one would also expect the root to be
         // traversed:
@@ -340,37 +398,41 @@ int MetaCommands::foreachChild(string ident,
     if (!pathString.empty()) {
         pathString += OBJECT_PATH_SEPARATOR;
     }
-    std::set<Object*> forbiddenObjects; // objects that may not be visited again
-    std::queue<pair<string,Object*>> todoList; // objects that still need to be visited
-    todoList.push(make_pair(pathString, parent));
-    while (!todoList.empty()) {
-        string objectPath = todoList.front().first;
-        Object* object = todoList.front().second;
-        todoList.pop();
-        for (const auto& entry : object->children()) {
-            Object* child = entry.second;
-            if (!filterName.empty() && !filterName.matches(entry.first)) {
-                // if we filter by name and the entry name does not match the filter,
-                // then skip this child
-                continue;
-            }
-            if (unique || recursive) {
-                if (forbiddenObjects.find(child) != forbiddenObjects.end()) {
-                    // if the object is already in the set of objects
-                    // that may not be visited again, then
-                    // skip this child;
+    {
+        // objects that may not be visited again. No command runs while
+        // this set exists, so none of these objects can be deleted
+        std::unordered_set<Object*> forbiddenObjects;
+        // objects that still need to be visited, with their path prefix
+        std::queue<pair<string,Object*>> todoList;
+        todoList.push(std::make_pair(pathString, parent));
+        while (!todoList.empty()) {
+            string objectPath = todoList.front().first;
+            Object* object = todoList.front().second;
+            todoList.pop();
+            for (const auto& entry : object->children()) {
+                Object* child = entry.second;
+                if (!filterName.empty() && !filterName.matches(entry.first)) {
+                    // if we filter by name and the entry name does not match the filter,
+                    // then skip this child
                     continue;
                 }
-                forbiddenObjects.insert(child);
-            }
-            string currentChildPath = objectPath + entry.first;
-            if (recursive) {
-                todoList.push(make_pair(currentChildPath + OBJECT_PATH_SEPARATOR, child));
+                if (unique || recursive) {
+                    if (!forbiddenObjects.insert(child).second) {
+                        // if the object is already in the set of objects
+                        // that may not be visited again, then
+                        // skip this child;
+                        continue;
+                    }
+                }
+                string currentChildPath = objectPath + entry.first;
+                if (recursive) {
+                    todoList.push(std::make_pair(currentChildPath + OBJECT_PATH_SEPARATOR, child));
+                }
+                childPaths.push_back(currentChildPath);
             }
-            childPaths.push_back(currentChildPath);
         }
     }
-    int  lastStatusCode = 0;
+    int lastStatusCode = 0;
     for (const auto& child : childPaths) {
         Input carryover = nestedCommand;
         carryover.replace(ident, child);
@@ -453,6 +515,62 @@ MetaCommands::FormatString MetaCommands::parseFormatString(const string &format)
     return blobs;
 }
 
+/**
+ * @brief the parsed format string, taken from the cache of recently
+ * used format strings if possible. Parse errors are not cached.
+ */
+shared_ptr<const MetaCommands::FormatString>
+MetaCommands::cachedFormatString(const string& format)
+{
+    auto it = formatCacheIndex_.find(format);
+    if (it != formatCacheIndex_.end()) {
+        // move the entry to the front
+        formatCache_.splice(formatCache_.begin(), formatCache_, it->second);
+        return it->second->second;
+    }
+    auto parsed = make_shared<const FormatString>(parseFormatString(format));
+    if (formatCache_.size() >= cacheCapacity_) {
+        // drop the least recently used entry
+        formatCacheIndex_.erase(formatCache_.back().first);
+        formatCache_.pop_back();
+    }
+    formatCache_.emplace_front(format, parsed);
+    formatCacheIndex_[format] = formatCache_.begin();
+    return parsed;
+}
+
+/**
+ * @brief the same as getAttributeOrException() but remembers the
+ * attribute for paths that do not pass a dynamic child, until the
+ * object tree changes.
+ */
+Attribute* MetaCommands::cachedAttributeOrException(const string& path)
+{
+    if (attributeCacheGeneration_ != Object::treeGeneration()) {
+        attributeCache_.clear();
+        attributeCacheGeneration_ = Object::treeGeneration();
+    }
+    auto it = attributeCache_.find(path);
+    if (it != attributeCache_.end()) {
+        return it->second;
+    }
+    Attribute* attribute = getAttributeOrException(path);
+    // check whether the path passes a dynamic child
+    Object* object = &root;
+    Path objectPath = Object::splitPath(path).first;
+    for (const auto& name : objectPath) {
+        if (object->isDynamicChild(name)) {
+            return attribute;
+        }
+        object = object->child(name);
+    }
+    if (attributeCache_.size() >= cacheCapacity_) {
+        attributeCache_.clear();
+    }
+    attributeCache_[path] = attribute;
+    return attribute;
+}
+
 string MetaCommands::evaluateFormatString(const FormatString& format,
                                           function<string()> nextToken,
                                           Output output)
@@ -465,13 +583,13 @@ string MetaCommands::evaluateFormatString(const FormatString& format,
             buf << nextToken();
         } else if (blob.data_ == "{") {
             auto attrpath = evaluateFormatString(blob.nested_, nextToken, output);
-            Attribute* a = getAttributeOrException(attrpath);
+            Attribute* a = cachedAttributeOrException(attrpath);
             if (a) {
                 buf << a->str();
             }
         } else {
             // hence, data is "s", i.e. a %s format
-            Attribute* a = getAttributeOrException(nextToken());
+            Attribute* a = cachedAttributeOrException(nextToken());
             if (a) {
                 buf << a->str();
             }
@@ -486,7 +604,6 @@ int MetaCommands::sprintf_cmd(Input input, Output output)
     if (!(input >> ident >> formatStringSrc)) {
         return HERBST_NEED_MORE_ARGS;
     }
-    FormatString format;
     string replacedString = "";
     function<string()> nextToken = [&input]() {
         string s;
@@ -497,9 +614,9 @@ int MetaCommands::sprintf_cmd(Input input, Output output)
         }
     };
     try {
-        format = parseFormatString(formatStringSrc);
+        auto format = cachedFormatString(formatStringSrc);
         // evaluate placeholders in the format string
-        replacedString = evaluateFormatString(format, nextToken, output);
+        replacedString = evaluateFormatString(*format, nextToken, output);
     }  catch (const std::invalid_argument& e) {
         output.perror() << e.what() << endl;
         return HERBST_INVALID_ARGUMENT;
@@ -516,15 +633,15 @@ void MetaCommands::sprintf_complete(Completion& complete)
     } else if (complete == 1) {
         // no completion for format string
     } else {
-        FormatString fs;
+        shared_ptr<const FormatString> fs;
         try {
-            fs = parseFormatString(complete[1]);
+            fs = cachedFormatString(complete[1]);
         }  catch (const std::invalid_argument&) {
             complete.invalidArguments();
             return;
         }
         int indexOfNextArgument = 2;
-        for (const auto& b : fs) {
+        for (const auto& b : *fs) {
             if (b.literal_ == true) {
                 continue;
             }
@@ -805,17 +922,24 @@ void MetaCommands::completeObjectPath(Completion& complete, Object* rootObject,
     if (!object) {
         return;
     }
+    // only look at the entries that possibly match the needle
+    string namePrefix = complete.wordPrefix();
+    if (stringStartsWith(namePrefix, objectPath)) {
+        namePrefix.erase(0, objectPath.size());
+    } else {
+        namePrefix = "";
+    }
     if (attributes) {
-        for (auto& it : object->attributes()) {
-            if (attributeFilter && !attributeFilter(it.second)) {
-                continue;
+        object->attributesWithPrefix(namePrefix, [&](Attribute* attribute) {
+            if (attributeFilter && !attributeFilter(attribute)) {
+                return;
             }
-            complete.full(objectPath + it.first);
-        }
-    }
-    for (auto& it : object->children()) {
-        complete.partial(objectPath + it.first + OBJECT_PATH_SEPARATOR);
+            complete.full(objectPath + attribute->name());
+        });
     }
+    object->childrenWithPrefix(namePrefix, [&](const string& name, Object*) {
+        complete.partial(objectPath + name + OBJECT_PATH_SEPARATOR);
+    });
 }
 
 void MetaCommands::completeObjectPath(Completion& complete, bool attributes,
@@ -1091,7 +1215,7 @@ void MetaCommands::completeEnvName(Completion& complete) {
 
 int MetaCommands::chainCommand(Input input, Output output)
 {
-    vector<vector<string>> commands = splitCommandList(input.toVector());
+    vector<Input> commands = splitCommandList(input);
     int returnCode = 0;
     // the condition that has to be fulfilled if we want to continue
     // execuding commands. the default (for 'chain') is to always continue
@@ -1105,12 +1229,7 @@ int MetaCommands::chainCommand(Input input, Output output)
         // continue executing commands while they are failing
         conditionContinue = [](int code) { return code >= 1; };
     }
-    for (auto& cmd : commands) {
-        if (cmd.empty()) {
-            // if command range is empty, do nothing
-            continue;
-        }
-        Input cmdinput = Input(cmd[0], cmd.begin() + 1, cmd.end());
+    for (auto& cmdinput : commands) {
         returnCode = Commands::call(cmdinput, output);
         if (!conditionContinue(returnCode)) {
             break;
@@ -1142,22 +1261,29 @@ void MetaCommands::chainCompletion(Completion& complete)
 }
 
 
-vector<vector<string>> MetaCommands::splitCommandList(ArgList::Container input) {
-    vector<vector<string>> res;
+/*!
+ * Split the input at the separator, which is the first token of the input.
+ * The returned commands share the arguments with the input, and empty
+ * commands are dropped.
+ */
+vector<Input> MetaCommands::splitCommandList(const Input& input) {
+    vector<Input> res;
     if (input.empty()) {
         return res;
     }
-    vector<string> current;
-    string separator = input[0];
-    for (size_t i = 1; i < input.size(); i++) {
-        if (input[i] == separator) {
-            res.push_back(current);
-            current = {};
-        } else {
-            current.push_back(input[i]);
+    const string& separator = *input.begin();
+    auto commandBegin = input.begin() + 1;
+    for (auto it = commandBegin; it != input.end(); it++) {
+        if (*it == separator) {
+            if (commandBegin != it) {
+                res.push_back(input.slice(commandBegin, it));
+            }
+            commandBegin = it + 1;
         }
     }
-    res.push_back(current);
+    if (commandBegin != input.end()) {
+        res.push_back(input.slice(commandBegin, input.end()));
+    }
     return res;
 }
 
@@ -2,7 +2,10 @@
 #define __HERBSTLUFT_METACOMMANDS_H_
 
 #include <functional>
+#include <list>
 #include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "attribute.h"
@@ -46,6 +49,7 @@ public:
     void print_object_tree_complete(Completion& complete);
     int attrTypeCommand(Input input, Output output);
     void attrTypeCompletion(Completion& complete);
+    void dumpTreeCommand(CallOrComplete invoc);
 
     int substitute_cmd(Input input, Output output);
     void substitute_complete(Completion& complete);
@@ -95,7 +99,7 @@ public:
     int chainCommand(Input input, Output output);
     void chainCompletion(Completion& complete);
 
-    std::vector<std::vector<std::string>> splitCommandList(ArgList::Container input);
+    std::vector<Input> splitCommandList(const Input& input);
 private:
     Object& root;
     std::vector<std::unique_ptr<Attribute>> userAttributes_;
@@ -109,9 +113,26 @@ private:
     typedef std::vector<FormatStringBlob> FormatString;
     FormatString parseFormatString(const std::string& format);
     FormatString parseFormatString(const std::string& format, size_t& idx);
+    std::shared_ptr<const FormatString> cachedFormatString(const std::string& format);
     std::string evaluateFormatString(const FormatString& format,
                                      std::function<std::string()> nextToken,
                                      Output output);
+    Attribute* cachedAttributeOrException(const std::string& path);
+
+    //! the maximal number of entries in formatCache_ and attributeCache_
+    static const size_t cacheCapacity_;
+    /** The recently parsed format strings, the most recently used first.
+     * The index maps the format strings to their position in the list.
+     */
+    using FormatCacheList =
+        std::list<std::pair<std::string, std::shared_ptr<const FormatString>>>;
+    FormatCacheList formatCache_;
+    std::unordered_map<std::string, FormatCacheList::iterator> formatCacheIndex_;
+    /** the recently resolved attribute paths. The cache is valid as
+     * long as Object::treeGeneration() equals attributeCacheGeneration_
+     */
+    std::unordered_map<std::string, Attribute*> attributeCache_;
+    unsigned long attributeCacheGeneration_ = 0;
 };
 
 
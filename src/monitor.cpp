@@ -13,6 +13,7 @@
 #include "ewmh.h"
 #include "floating.h"
 #include "frametree.h"
+#include "freezer.h"
 #include "globals.h"
 #include "hook.h"
 #include "ipc-protocol.h"
@@ -26,6 +27,7 @@
 #include "utils.h"
 
 using std::endl;
+using std::shared_ptr;
 using std::string;
 using std::stringstream;
 using std::vector;
@@ -181,28 +183,7 @@ void Monitor::applyLayout() {
     if (tag->floating_focused) {
         res.focus = tag->focusedClient();
     }
-    if (tag->floating) {
-        for (auto& p : res.data) {
-            p.second.floated = true;
-            // deactivate smart_window_surroundings in floating mode
-            p.second.minimalDecoration = false;
-        }
-    }
-    // preprocessing
-    for (auto& p : res.data) {
-        if (p.first->fullscreen_() || p.second.floated) {
-            // do not hide fullscreen windows
-            p.second.visible = true;
-        }
-        if (settings->hide_covered_windows) {
-            // apply hiding of windows: move them to out of the screen:
-            if (!p.second.visible) {
-                Rectangle& geo = p.second.geometry;
-                geo.x = -100 - geo.width;
-                geo.y = -100 - geo.height;
-            }
-        }
-    }
+    preprocessTilingResult(res);
     // 1. Update stack (TODO: why stack first?)
     for (auto& p : res.data) {
         Client* c = p.first;
@@ -241,18 +222,7 @@ void Monitor::applyLayout() {
     }
     restack();
     // 2. Update window geometries
-    for (auto& p : res.data) {
-        Client* c = p.first;
-        bool clientFocused = isFocused && res.focus == c;
-        if (c->fullscreen_()) {
-            c->resize_fullscreen(rect, clientFocused);
-        } else if (p.second.floated) {
-            c->resize_floating(this, clientFocused);
-        } else {
-            bool minDec = p.second.minimalDecoration;
-            c->resize_tiling(p.second.geometry, clientFocused, minDec, p.second.tabs);
-        }
-    }
+    applyClientGeometries(res, res.focus, isFocused);
     for (auto& c : tag->floating_clients_) {
         if (c->fullscreen_()) {
             c->resize_fullscreen(rect, res.focus == c && isFocused);
@@ -260,16 +230,7 @@ void Monitor::applyLayout() {
             c->resize_floating(this, res.focus == c && isFocused);
         }
     }
-    if (tag->floating) {
-        for (auto& p : res.frames) {
-            p.first->hide();
-        }
-    } else {
-        for (auto& p : res.frames) {
-            p.first->render(p.second, p.first == res.focused_frame && isFocused);
-            p.first->updateVisibility(p.second, p.first == res.focused_frame && isFocused);
-        }
-    }
+    renderFrames(res, res.focused_frame, isFocused);
     if (isFocused) {
         if (res.focus) {
             Root::get()->clients()->focus = res.focus;
@@ -284,6 +245,92 @@ void Monitor::applyLayout() {
     monman->dropEnterNotifyEvents.emit();
 }
 
+/**
+ * @brief Recompute and apply the layout only for the given subtree of the
+ * frame tree of this monitor's tag, e.g. after the fraction of a split has
+ * changed. This assumes that the subtree keeps its previous geometry
+ * within the tag and that nothing outside of it has changed. In all other
+ * cases (or if in doubt), applyLayout() needs to be called.
+ */
+void Monitor::applySubtreeLayout(shared_ptr<Frame> subtree)
+{
+    if (settings->monitors_locked() || tag->floating()
+        || subtree->root() != tag->frame->root_)
+    {
+        applyLayout();
+        return;
+    }
+    bool isFocused = get_current_monitor() == this;
+    TilingResult res = subtree->computeLayout(subtree->lastRect());
+    preprocessTilingResult(res);
+    applyClientGeometries(res, tag->focusedClient(), isFocused);
+    // the focused frame of the subtree is the focused frame
+    // of the tag only if the subtree itself is focused
+    FrameDecoration* focusedFrame =
+            subtree->isFocused() ? res.focused_frame : nullptr;
+    renderFrames(res, focusedFrame, isFocused);
+    monman->dropEnterNotifyEvents.emit();
+}
+
+//! adjust the tiling result to the settings and the tag's floating mode
+void Monitor::preprocessTilingResult(TilingResult& res)
+{
+    if (tag->floating) {
+        for (auto& p : res.data) {
+            p.second.floated = true;
+            // deactivate smart_window_surroundings in floating mode
+            p.second.minimalDecoration = false;
+        }
+    }
+    for (auto& p : res.data) {
+        if (p.first->fullscreen_() || p.second.floated) {
+            // do not hide fullscreen windows
+            p.second.visible = true;
+        }
+        if (settings->hide_covered_windows) {
+            // apply hiding of windows: move them to out of the screen:
+            if (!p.second.visible) {
+                Rectangle& geo = p.second.geometry;
+                geo.x = -100 - geo.width;
+                geo.y = -100 - geo.height;
+            }
+        }
+    }
+}
+
+//! move and resize the clients of the tiling result
+void Monitor::applyClientGeometries(TilingResult& res, Client* focus, bool isFocused)
+{
+    for (auto& p : res.data) {
+        Client* c = p.first;
+        bool clientFocused = isFocused && focus == c;
+        if (c->fullscreen_()) {
+            c->resize_fullscreen(rect, clientFocused);
+        } else if (p.second.floated) {
+            c->resize_floating(this, clientFocused);
+        } else {
+            bool minDec = p.second.minimalDecoration;
+            c->resize_tiling(p.second.geometry, clientFocused, minDec,
+                             p.second.tabs, !p.second.visible);
+        }
+    }
+}
+
+//! render the frame decorations of the tiling result
+void Monitor::renderFrames(TilingResult& res, FrameDecoration* focusedFrame, bool isFocused)
+{
+    if (tag->floating) {
+        for (auto& p : res.frames) {
+            p.first->hide();
+        }
+    } else {
+        for (auto& p : res.frames) {
+            p.first->render(p.second, p.first == focusedFrame && isFocused);
+            p.first->updateVisibility(p.second, p.first == focusedFrame && isFocused);
+        }
+    }
+}
+
 Monitor* find_monitor_by_name(const char* name) {
     for (auto m : *g_monitors) {
         if (m->name == name) {
@@ -608,6 +655,11 @@ Rectangle Monitor::clampRelativeGeometry(Rectangle relativeGeo) const
 }
 
 void Monitor::restack() {
+    Freezer* freezer = Freezer::ifFrozen();
+    if (freezer) {
+        freezer->deferMonitorRestack();
+        return;
+    }
     Window fullscreenFocus = 0;
     /* don't add a focused fullscreen client to the stack because
      * we want a focused fullscreen window to be above the panels which are
@@ -2,15 +2,20 @@
 #define __HERBSTLUFT_MONITOR_H_
 
 #include <X11/X.h>
+#include <memory>
 
 #include "attribute_.h"
 #include "object.h"
 #include "rectangle.h"
 #include "rules.h"
 
+class Client;
+class Frame;
+class FrameDecoration;
 class HSTag;
 class MonitorManager;
 class Settings;
+class TilingResult;
 
 class Monitor : public Object {
 public:
@@ -56,12 +61,16 @@ public:
     void renameComplete(Completion& complete);
     bool setTag(HSTag* new_tag);
     void applyLayout();
+    void applySubtreeLayout(std::shared_ptr<Frame> subtree);
     void restack();
     std::string getDescription();
     void evaluateClientPlacement(Client* client, ClientPlacement placement) const;
     void evaluateClientPlacementCorner(Client* client, Point2D (Rectangle::*corner)() const) const;
     static std::string atLeastMinWindowSize(Rectangle geom);
 private:
+    void preprocessTilingResult(TilingResult& res);
+    void applyClientGeometries(TilingResult& res, Client* focus, bool isFocused);
+    void renderFrames(TilingResult& res, FrameDecoration* focusedFrame, bool isFocused);
     std::string getTagString();
     std::string setTagString(std::string new_tag);
     Settings* settings;
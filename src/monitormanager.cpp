@@ -11,6 +11,7 @@
 #include "ewmh.h"
 #include "floating.h"
 #include "frametree.h"
+#include "freezer.h"
 #include "globals.h"
 #include "ipc-protocol.h"
 #include "monitor.h"
@@ -520,6 +521,11 @@ void MonitorManager::extractWindowStack(bool real_clients, function<void(Window)
 
 //! restack the entire stack including all monitors
 void MonitorManager::restack() {
+    Freezer* freezer = Freezer::ifFrozen();
+    if (freezer) {
+        freezer->deferRestack();
+        return;
+    }
     vector<Window> buf;
     extractWindowStack(false, [&buf](Window w) { buf.push_back(w); });
     DesktopWindow::foreachDesktopWindow([&buf](DesktopWindow& dw) {
@@ -1,5 +1,6 @@
 #include "mouse.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <sstream>
 
@@ -82,13 +83,6 @@ void Converter<MouseCombo>::complete(Completion& outerComplete, MouseCombo const
     ModifiersWithString::complete(outerComplete, buttonCompleter);
 }
 
-struct SnapData {
-    Client*       client = nullptr;
-    Rectangle      rect;
-    enum SnapFlags  flags = {};
-    int             dx = 0, dy = 0; // the vector from client to other to make them snap
-};
-
 bool is_point_between(int point, int left, int right) {
     return (point < right && point >= left);
 }
@@ -104,45 +98,122 @@ static void snap_1d(int x, int edge, int* delta) {
     }
 }
 
-static void client_snap_helper(Client* candidate, struct SnapData* d) {
-    if (candidate == d->client) {
+/**
+ * @brief A possible snapping vector in one dimension. Among multiple
+ * candidates of the same length, the one of the window coming first in
+ * the tag is preferred, just as if the windows were checked one by one.
+ */
+class SnapEdgeIndex::Candidate {
+public:
+    Candidate(int initialDelta) : delta(initialDelta) {}
+    void offer(int newDelta, long newOrder) {
+        if (abs(newDelta) < abs(delta)
+            || (abs(newDelta) == abs(delta) && newOrder < order))
+        {
+            delta = newDelta;
+            order = newOrder;
+        }
+    }
+    int delta;
+    //! the initial delta (e.g. from the monitor edges) is always preferred
+    long order = -1;
+};
+
+void SnapEdgeIndex::update(HSTag* tag, Client* dragged)
+{
+    if (tag == tag_ && dragged == dragged_
+        && tag->clientListGeneration() == tagGeneration_)
+    {
         return;
     }
-    auto subject  = d->rect;
-    auto other    = candidate->dec->last_outer();
-    // increase other by snap gap
-    other.x -= g_settings->snap_gap();
-    other.y -= g_settings->snap_gap();
-    other.width += g_settings->snap_gap() * 2;
-    other.height += g_settings->snap_gap() * 2;
-    if (intervals_intersect(other.y, other.y + other.height, subject.y, subject.y + subject.height)) {
-        // check if x can snap to the right
-        if (d->flags & SNAP_EDGE_RIGHT) {
-            snap_1d(subject.x + subject.width, other.x, &d->dx);
-        }
-        // or to the left
-        if (d->flags & SNAP_EDGE_LEFT) {
-            snap_1d(subject.x, other.x + other.width, &d->dx);
+    tag_ = tag;
+    dragged_ = dragged;
+    tagGeneration_ = tag->clientListGeneration();
+    windows_.clear();
+    tag->foreachClient([this] (Client* c) {
+        if (c != dragged_) {
+            windows_.push_back(c->dec->last_outer());
         }
+    });
+    for (auto* edges : { &leftEdges_, &rightEdges_, &topEdges_, &bottomEdges_ }) {
+        edges->clear();
+        edges->reserve(windows_.size());
     }
-    if (intervals_intersect(other.x, other.x + other.width, subject.x, subject.x + subject.width)) {
-        // if we can snap to the top
-        if (d->flags & SNAP_EDGE_TOP) {
-            snap_1d(subject.y, other.y + other.height, &d->dy);
-        }
-        // or to the bottom
-        if (d->flags & SNAP_EDGE_BOTTOM) {
-            snap_1d(subject.y + subject.height, other.y, &d->dy);
+    for (size_t i = 0; i < windows_.size(); i++) {
+        const Rectangle& r = windows_[i];
+        leftEdges_.push_back({ r.x, i });
+        rightEdges_.push_back({ r.x + r.width, i });
+        topEdges_.push_back({ r.y, i });
+        bottomEdges_.push_back({ r.y + r.height, i });
+    }
+    for (auto* edges : { &leftEdges_, &rightEdges_, &topEdges_, &bottomEdges_ }) {
+        std::stable_sort(edges->begin(), edges->end());
+    }
+}
+
+void SnapEdgeIndex::snap(const Rectangle& subject, SnapFlags flags, int gap,
+                         int* dx, int* dy) const
+{
+    // the initial deltas also are the maximal snapping distances
+    int distanceX = abs(*dx);
+    int distanceY = abs(*dy);
+    Candidate bestX(*dx);
+    Candidate bestY(*dy);
+    // for the i'th window, the right edge of the subject is considered
+    // before its left edge, and the top edge before its bottom edge.
+    if (flags & SNAP_EDGE_RIGHT) {
+        snapToEdges(leftEdges_, -1, true, subject, subject.x + subject.width,
+                    gap, distanceX, 0, bestX);
+    }
+    if (flags & SNAP_EDGE_LEFT) {
+        snapToEdges(rightEdges_, 1, true, subject, subject.x,
+                    gap, distanceX, 1, bestX);
+    }
+    if (flags & SNAP_EDGE_TOP) {
+        snapToEdges(bottomEdges_, 1, false, subject, subject.y,
+                    gap, distanceY, 0, bestY);
+    }
+    if (flags & SNAP_EDGE_BOTTOM) {
+        snapToEdges(topEdges_, -1, false, subject, subject.y + subject.height,
+                    gap, distanceY, 1, bestY);
+    }
+    *dx = bestX.delta;
+    *dy = bestY.delta;
+}
+
+/**
+ * @brief offer all edges whose position plus sign*gap is closer than
+ * 'distance' to 'target', if the respective window (enlarged by the gap)
+ * is next to the subject in the other dimension.
+ */
+void SnapEdgeIndex::snapToEdges(const vector<Edge>& edges, int sign, bool xAxis,
+                                const Rectangle& subject, int target, int gap,
+                                int distance, long order, Candidate& best) const
+{
+    int offset = sign * gap;
+    Edge lowest = { target - offset - distance + 1, 0 };
+    for (auto it = std::lower_bound(edges.begin(), edges.end(), lowest);
+         it != edges.end() && it->position + offset - target < distance;
+         it++)
+    {
+        const Rectangle& other = windows_[it->window];
+        bool neighboured = xAxis
+            ? intervals_intersect(other.y - gap, other.y + other.height + gap,
+                                  subject.y, subject.y + subject.height)
+            : intervals_intersect(other.x - gap, other.x + other.width + gap,
+                                  subject.x, subject.x + subject.width);
+        if (neighboured) {
+            best.offer(it->position + offset - target,
+                       static_cast<long>(it->window) * 2 + order);
         }
     }
-    return;
 }
 
 // get the vector to snap a client to it's neighbour
 void client_snap_vector(Client* client, Monitor* monitor,
+                        SnapEdgeIndex& edges,
                         enum SnapFlags flags,
                         int* return_dx, int* return_dy) {
-    struct SnapData d = {};
     HSTag* tag = monitor->tag;
     int distance = std::max(0, g_settings->snap_distance());
     // init delta
@@ -152,39 +223,37 @@ void client_snap_vector(Client* client, Monitor* monitor,
         // nothing to do
         return;
     }
-    d.client    = client;
     // translate client rectangle to global coordinates
-    d.rect      = client->outer_floating_rect();
-    d.rect.x += monitor->rect->x + monitor->pad_left;
-    d.rect.y += monitor->rect->y + monitor->pad_up;
-    d.flags     = flags;
-    d.dx        = distance;
-    d.dy        = distance;
+    Rectangle rect = client->outer_floating_rect();
+    rect.x += monitor->rect->x + monitor->pad_left;
+    rect.y += monitor->rect->y + monitor->pad_up;
+    int dx = distance;
+    int dy = distance;
 
     // snap to monitor edges
     Monitor* m = monitor;
     if (flags & SNAP_EDGE_TOP) {
-        snap_1d(d.rect.y, m->rect->y + m->pad_up + g_settings->snap_gap(), &d.dy);
+        snap_1d(rect.y, m->rect->y + m->pad_up + g_settings->snap_gap(), &dy);
     }
     if (flags & SNAP_EDGE_LEFT) {
-        snap_1d(d.rect.x, m->rect->x + m->pad_left + g_settings->snap_gap(), &d.dx);
+        snap_1d(rect.x, m->rect->x + m->pad_left + g_settings->snap_gap(), &dx);
     }
     if (flags & SNAP_EDGE_RIGHT) {
-        snap_1d(d.rect.x + d.rect.width, m->rect->x + m->rect->width - m->pad_right - g_settings->snap_gap(), &d.dx);
+        snap_1d(rect.x + rect.width, m->rect->x + m->rect->width - m->pad_right - g_settings->snap_gap(), &dx);
     }
     if (flags & SNAP_EDGE_BOTTOM) {
-        snap_1d(d.rect.y + d.rect.height, m->rect->y + m->rect->height - m->pad_down - g_settings->snap_gap(), &d.dy);
+        snap_1d(rect.y + rect.height, m->rect->y + m->rect->height - m->pad_down - g_settings->snap_gap(), &dy);
     }
 
     // snap to other clients
-    tag->foreachClient([&d] (Client* c) { client_snap_helper(c, &d); });
+    edges.update(tag, client);
+    edges.snap(rect, flags, g_settings->snap_gap(), &dx, &dy);
 
     // write back results
-    if (abs(d.dx) < abs(distance)) {
-        *return_dx = d.dx;
+    if (abs(dx) < abs(distance)) {
+        *return_dx = dx;
     }
-    if (abs(d.dy) < abs(distance)) {
-        *return_dy = d.dy;
+    if (abs(dy) < abs(distance)) {
+        *return_dy = dy;
     }
 }
-
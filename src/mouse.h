@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "keycombo.h"
+#include "rectangle.h"
 
 // various snap-flags
 enum SnapFlags {
@@ -19,6 +20,7 @@ enum SnapFlags {
 
 // forward declarations
 class Client;
+class HSTag;
 class Monitor;
 
 class MouseCombo : public ModifierCombo {
@@ -36,8 +38,46 @@ public:
 
 ConverterInstance(MouseCombo)
 
+/**
+ * @brief The SnapEdgeIndex holds the edges of all windows on a tag
+ * (except for the dragged one) sorted by their coordinates. This way,
+ * the edges within the snap_distance are found by a binary search
+ * instead of visiting all windows on every motion event of a drag.
+ * The index is only rebuilt if a client enters or leaves the tag.
+ */
+class SnapEdgeIndex {
+public:
+    //! rebuild the index if the tag or its clients have changed
+    void update(HSTag* tag, Client* dragged);
+    //! find the edge closest to the given rectangle (with respect to
+    //! the given flags) and update dx and dy if it is closer than them
+    void snap(const Rectangle& subject, SnapFlags flags, int gap,
+              int* dx, int* dy) const;
+private:
+    struct Edge {
+        int position; //! the coordinate of the edge
+        size_t window; //! the index of the window in windows_
+        bool operator<(const Edge& other) const {
+            return position < other.position;
+        }
+    };
+    class Candidate;
+    void snapToEdges(const std::vector<Edge>& edges, int sign, bool xAxis,
+                     const Rectangle& subject, int target, int gap,
+                     int distance, long order, Candidate& best) const;
+    std::vector<Rectangle> windows_; //! outlines in foreachClient() order
+    std::vector<Edge> leftEdges_;
+    std::vector<Edge> rightEdges_;
+    std::vector<Edge> topEdges_;
+    std::vector<Edge> bottomEdges_;
+    HSTag* tag_ = nullptr;
+    Client* dragged_ = nullptr;
+    unsigned long tagGeneration_ = 0;
+};
+
 // get the vector to snap a client to it's neighbour
 void client_snap_vector(Client* client, Monitor* monitor,
+                        SnapEdgeIndex& edges,
                         enum SnapFlags flags,
                         int* return_dx, int* return_dy);
 
@@ -29,6 +29,7 @@ MouseDragHandlerFloating::MouseDragHandlerFloating(MonitorManager* monitors, Tag
         winDragStart_ = dragMonitor_->clampRelativeGeometry(winDragStart_);
     }
     assertDraggingStillSafe();
+    snapEdges_.update(dragMonitor_->tag, winDragClient_);
 }
 
 void MouseDragHandlerFloating::handle_motion_event(Point2D newCursorPos)
@@ -99,7 +100,7 @@ void MouseDragHandlerFloating::mouse_function_move(Point2D newCursorPos) {
     winDragClient_->float_size_ = winDragStart_.shifted({x_diff, y_diff});
     // snap it to other windows
     int dx, dy;
-    client_snap_vector(winDragClient_, dragMonitor_,
+    client_snap_vector(winDragClient_, dragMonitor_, snapEdges_,
                        SNAP_EDGE_ALL, &dx, &dy);
     winDragClient_->float_size_ = winDragClient_->float_size_->shifted({dx, dy});
     winDragClient_->resize_floating(dragMonitor_, get_current_client() == winDragClient_);
@@ -169,7 +170,7 @@ void MouseDragHandlerFloating::mouse_function_resize(Point2D newCursorPos) {
     } else {
         snap_flags |= SNAP_EDGE_BOTTOM;
     }
-    client_snap_vector(winDragClient_, dragMonitor_,
+    client_snap_vector(winDragClient_, dragMonitor_, snapEdges_,
                        (SnapFlags)snap_flags, &dx, &dy);
     if (left) {
         new_geometry.x += dx;
@@ -227,9 +228,9 @@ void MouseDragHandlerFloating::mouse_function_zoom(Point2D newCursorPos) {
     int right_dx, bottom_dy;
     int left_dx, top_dy;
     // we have to distinguish the direction in which we zoom
-    client_snap_vector(winDragClient_, m,
+    client_snap_vector(winDragClient_, m, snapEdges_,
                      (SnapFlags)(SNAP_EDGE_BOTTOM | SNAP_EDGE_RIGHT), &right_dx, &bottom_dy);
-    client_snap_vector(winDragClient_, m,
+    client_snap_vector(winDragClient_, m, snapEdges_,
                        (SnapFlags)(SNAP_EDGE_TOP | SNAP_EDGE_LEFT), &left_dx, &top_dy);
     // e.g. if window snaps by vector (3,3) at topleft, window has to be shrinked
     // but if the window snaps by vector (3,3) at bottomright, window has to grow
@@ -301,7 +302,29 @@ void MouseResizeFrame::handle_motion_event(Point2D newCursorPos)
         int delta = (deltaVec.y * dragStartFractionY_.unit_) / dragDistanceUnitY_;
         dfY->setFraction(dragStartFractionY_ + FixPrecDec::raw(delta));
     }
-    dragMonitor_->applyLayout();
+    // only relayout the subtrees of the modified splits. If one of them
+    // is contained in the other, then the outer one suffices.
+    if (dfX && dfY && isInSubtree(dfY, dfX)) {
+        dfY = {};
+    } else if (dfX && dfY && isInSubtree(dfX, dfY)) {
+        dfX = {};
+    }
+    for (const auto& split : { dfX, dfY }) {
+        if (split) {
+            dragMonitor_->applySubtreeLayout(split);
+        }
+    }
+}
+
+//! whether the frame is the given subtree or a (possibly indirect) child of it
+bool MouseResizeFrame::isInSubtree(shared_ptr<Frame> frame, shared_ptr<Frame> subtree)
+{
+    for (; frame; frame = frame->getParent()) {
+        if (frame == subtree) {
+            return true;
+        }
+    }
+    return false;
 }
 
 MouseDragHandler::Constructor MouseResizeFrame::construct(shared_ptr<FrameLeaf> frame, const ResizeAction& resize)
@@ -5,9 +5,11 @@
 
 #include "decoration.h"
 #include "fixprecdec.h"
+#include "mouse.h"
 #include "rectangle.h"
 
 class Client;
+class Frame;
 class FrameLeaf;
 class FrameSplit;
 class HSTag;
@@ -79,6 +81,7 @@ private:
     Monitor*       dragMonitor_ = nullptr;
     unsigned long dragMonitorIndex_ = 0;
     DragFunction dragFunction_ = nullptr;
+    SnapEdgeIndex snapEdges_; //! the edges of the other windows
 };
 
 
@@ -98,6 +101,7 @@ public:
     static Constructor construct(std::shared_ptr<FrameLeaf> frame, const ResizeAction& direction);
 private:
     void assertDraggingStillSafe();
+    static bool isInSubtree(std::shared_ptr<Frame> frame, std::shared_ptr<Frame> subtree);
 
     MonitorManager*  monitors_;
     Point2D          buttonDragStart_ = {};
@@ -21,6 +21,7 @@
 #include "mouse.h"
 #include "mousedraghandler.h"
 #include "root.h"
+#include "settings.h"
 #include "tag.h"
 #include "x11-utils.h"
 #include "xkeygrabber.h"
@@ -33,9 +34,11 @@ using std::endl;
 
 MouseManager::MouseManager()
     : dragHandler_({})
+    , motionTimeout_([this]() { applyMotion(); })
     , clients_(nullptr)
     , monitors_(nullptr)
     , tags_(nullptr)
+    , settings_(nullptr)
 {
     /* set cursor theme */
     cursor = XCreateFontCursor(g_display, XC_left_ptr);
@@ -53,11 +56,13 @@ MouseManager::~MouseManager() {
     XFreeCursor(g_display, cursor);
 }
 
-void MouseManager::injectDependencies(ClientManager* clients, TagManager* tags, MonitorManager* monitors)
+void MouseManager::injectDependencies(ClientManager* clients, TagManager* tags,
+                                      MonitorManager* monitors, Settings* settings)
 {
     clients_ = clients;
     monitors_ = monitors;
     tags_ = tags;
+    settings_ = settings;
 }
 
 int MouseManager::addMouseBindCommand(Input input, Output output) {
@@ -273,6 +278,7 @@ string MouseManager::mouse_initiate_drag(Client *client, const MouseDragHandler:
 
 void MouseManager::mouse_stop_drag() {
     // end those operations that have been started by mouse_initiate_drag()
+    motionTimeout_.stop();
     if (dragHandler_) {
         clients_->setDragged(nullptr);
         try {
@@ -284,12 +290,52 @@ void MouseManager::mouse_stop_drag() {
     }
 }
 
+/**
+ * @brief pass the new cursor position to the drag handler. If the setting
+ * drag_refresh_rate is set, then the first motion is applied immediately
+ * and all further motions within the refresh interval are coalesced into
+ * a single update at the end of the interval.
+ */
 void MouseManager::handle_motion_event(Point2D newCursorPos) {
+    if (!dragHandler_) {
+        return;
+    }
+    pendingCursorPos_ = newCursorPos;
+    int rate = settings_->drag_refresh_rate();
+    if (rate <= 0) {
+        applyMotion();
+        return;
+    }
+    if (motionTimeout_.isActive()) {
+        // the latest position will be applied when the timeout fires
+        return;
+    }
+    auto interval = std::chrono::microseconds(1000000 / rate);
+    auto nextUpdate = lastMotionUpdate_ + interval;
+    if (Timeout::Clock::now() >= nextUpdate) {
+        applyMotion();
+    } else {
+        motionTimeout_.startAt(nextUpdate);
+    }
+}
+
+//! apply the latest cursor position if it has not been applied yet
+void MouseManager::flushPendingMotion()
+{
+    if (motionTimeout_.isActive()) {
+        applyMotion();
+    }
+}
+
+void MouseManager::applyMotion()
+{
+    motionTimeout_.stop();
+    lastMotionUpdate_ = Timeout::Clock::now();
     if (!dragHandler_) {
         return;
     }
     try {
-        dragHandler_->handle_motion_event(newCursorPos);
+        dragHandler_->handle_motion_event(pendingCursorPos_);
     }  catch (const MouseDragHandler::DragNotPossible&) {
         mouse_stop_drag();
     }
@@ -8,21 +8,24 @@
 #include "mouse.h"
 #include "object.h"
 #include "optional.h"
+#include "timeout.h"
+#include "x11-types.h"
 
 class Completion;
 class ClientManager;
 class MonitorManager;
 class MouseDragHandler;
 class ResizeAction;
+class Settings;
 class TagManager;
-struct Point2D;
 
 class MouseManager : public Object {
 public:
     MouseManager();
     ~MouseManager();
 
-    void injectDependencies(ClientManager* clients, TagManager* tags, MonitorManager* monitors);
+    void injectDependencies(ClientManager* clients, TagManager* tags,
+                            MonitorManager* monitors, Settings* settings);
 
     int addMouseBindCommand(Input input, Output output);
 
@@ -36,6 +39,7 @@ public:
     void mouse_stop_drag();
     bool mouse_is_dragging();
     void handle_motion_event(Point2D newCursorPos);
+    void flushPendingMotion();
 
     int dragCommand(Input input, Output output);
     void dragCompletion(Completion& complete);
@@ -70,11 +74,16 @@ private:
     typedef std::function<std::shared_ptr<MouseDragHandler>(MonitorManager*, TagManager*, Client*)> MDC;
     //! start a the drag, and if it does not work out, return an error message
     std::string mouse_initiate_drag(Client* client, const MDC& createHandler, ResizeAction resize);
+    void applyMotion();
 
     std::map<std::string, MouseFunction> mouseFunctions_;
     std::shared_ptr<MouseDragHandler> dragHandler_;
+    Point2D pendingCursorPos_ = {}; //! the latest cursor position of the drag
+    Timeout motionTimeout_; //! pending motion if drag updates are rate limited
+    Timeout::Clock::time_point lastMotionUpdate_ = {};
     Cursor cursor;
     ClientManager*  clients_;
     MonitorManager*  monitors_;
     TagManager*  tags_;
+    Settings* settings_;
 };
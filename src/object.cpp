@@ -26,6 +26,20 @@ ChildEntry::ChildEntry(Object& owner, const string& name)
     owner_.addChildDoc(name_, this);
 }
 
+Hook* Object::treeHook_ = nullptr;
+unsigned long Object::treeGeneration_ = 0;
+
+Object::~Object()
+{
+    for (auto child : ownedChildren_) {
+        child->parent_ = nullptr;
+        child->nameInParent_.clear();
+    }
+    if (parent_) {
+        parent_->ownedChildren_.erase(this);
+    }
+}
+
 pair<ArgList,string> Object::splitPath(const string &path) {
     vector<string> splitpath = ArgList(path, OBJECT_PATH_SEPARATOR).toVector();
     if (splitpath.empty()) {
@@ -42,11 +56,13 @@ void Object::wireAttributes(vector<Attribute*> attrs)
         attr->setOwner(this);
         attribs_[attr->name()] = attr;
     }
+    treeGeneration_++;
 }
 
 void Object::addAttribute(Attribute* attr) {
     attr->setOwner(this);
     attribs_[attr->name()] = attr;
+    treeGeneration_++;
 }
 
 void Object::removeAttribute(Attribute* attr) {
@@ -58,6 +74,7 @@ void Object::removeAttribute(Attribute* attr) {
         return;
     }
     attribs_.erase(it);
+    treeGeneration_++;
 }
 
 void Object::ls(Output out)
@@ -150,6 +167,22 @@ Object* Object::child(Path path, Output output) {
 
 void Object::notifyHooks(HookEvent event, const string& arg)
 {
+    if (event != HookEvent::ATTRIBUTE_CHANGED) {
+        treeGeneration_++;
+    }
+    if (treeHook_) {
+        switch (event) {
+            case HookEvent::CHILD_ADDED:
+                treeHook_->childAdded(this, arg);
+                break;
+            case HookEvent::CHILD_REMOVED:
+                treeHook_->childRemoved(this, arg);
+                break;
+            case HookEvent::ATTRIBUTE_CHANGED:
+                treeHook_->attributeChanged(this, arg);
+                break;
+        }
+    }
     for (auto h : hooks_) {
         if (h) {
             switch (event) {
@@ -173,6 +206,12 @@ void Object::addDynamicChild(function<Object* ()> child, const string& name)
 }
 
 void Object::addChild(Object* child, const string &name)
+{
+    child->setParent(this, name);
+    addChildReference(child, name);
+}
+
+void Object::addChildReference(Object* child, const string &name)
 {
     children_[name] = child;
     notifyHooks(HookEvent::CHILD_ADDED, name);
@@ -181,7 +220,32 @@ void Object::addChild(Object* child, const string &name)
 void Object::removeChild(const string &child)
 {
     notifyHooks(HookEvent::CHILD_REMOVED, child);
-    children_.erase(child);
+    auto it = children_.find(child);
+    if (it == children_.end()) {
+        return;
+    }
+    Object* obj = it->second;
+    if (obj->parent_ == this && obj->nameInParent_ == child) {
+        obj->setParent(nullptr, {});
+    }
+    children_.erase(it);
+    // the hooks were notified before the removal, so the
+    // generation has to change again now
+    treeGeneration_++;
+}
+
+void Object::setParent(Object* parent, const string& name)
+{
+    if (parent_ != parent) {
+        if (parent_) {
+            parent_->ownedChildren_.erase(this);
+        }
+        if (parent) {
+            parent->ownedChildren_.insert(this);
+        }
+    }
+    parent_ = parent;
+    nameInParent_ = name;
 }
 
 void Object::addChildDoc(const string& name, HasDocumentation* doc)
@@ -232,6 +296,43 @@ std::map<string, Object*> Object::children() {
     return allChildren;
 }
 
+void Object::childrenWithPrefix(const string& prefix,
+                                function<void(const string&, Object*)> onChild)
+{
+    // the maps are sorted, so the matching names form a contiguous range
+    for (auto it = children_.lower_bound(prefix);
+         it != children_.end() && stringStartsWith(it->first, prefix);
+         it++)
+    {
+        auto dynamic = childrenDynamic_.find(it->first);
+        if (dynamic != childrenDynamic_.end() && dynamic->second()) {
+            // the dynamic child takes precedence, as in children()
+            continue;
+        }
+        onChild(it->first, it->second);
+    }
+    for (auto it = childrenDynamic_.lower_bound(prefix);
+         it != childrenDynamic_.end() && stringStartsWith(it->first, prefix);
+         it++)
+    {
+        Object* obj = it->second();
+        if (obj) {
+            onChild(it->first, obj);
+        }
+    }
+}
+
+void Object::attributesWithPrefix(const string& prefix,
+                                  function<void(Attribute*)> onAttribute)
+{
+    for (auto it = attribs_.lower_bound(prefix);
+         it != attribs_.end() && stringStartsWith(it->first, prefix);
+         it++)
+    {
+        onAttribute(it->second);
+    }
+}
+
 class DirectoryTreeInterface : public TreeInterface {
 public:
     DirectoryTreeInterface(string label, Object* d) : lbl(label), dir(d) {
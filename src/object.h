@@ -3,6 +3,7 @@
 
 #include <functional>
 #include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -44,7 +45,7 @@ class Object : public HasDocumentation {
 
 public:
     Object() = default;
-    virtual ~Object() = default;
+    virtual ~Object();
 
     // object tree ls command
     virtual void ls(Output out);
@@ -73,6 +74,18 @@ public:
 
     Object* child(Path path, Output output);
 
+    //! whether the given child is computed on every access, see addDynamicChild()
+    bool isDynamicChild(const std::string& name) const {
+        return childrenDynamic_.count(name) > 0;
+    }
+
+    /** A counter that changes whenever a child is added or removed or
+     * an attribute is added or removed anywhere in the object tree. So
+     * the result of resolving a path that does not pass a dynamic
+     * child stays valid as long as this counter does not change.
+     */
+    static unsigned long treeGeneration() { return treeGeneration_; }
+
     /* Called by the directory whenever children are added or removed */
     void notifyHooks(HookEvent event, const std::string &arg);
 
@@ -81,9 +94,25 @@ public:
      */
     void addDynamicChild(std::function<Object*()> child, const std::string &name);
 
+    //! add a child that is owned by this object. This makes 'this'
+    //! the parent of the child, see parent() and nameInParent().
     void addChild(Object* child, const std::string &name);
+    //! add a child that is only a reference to an object living
+    //! somewhere else in the tree (e.g. 'clients.focus')
+    void addChildReference(Object* child, const std::string &name);
     void removeChild(const std::string &child);
 
+    //! the object that owns this object in the object tree, or
+    //! nullptr if this object is not (yet) part of the tree
+    Object* parent() const { return parent_; }
+    //! the name of this object in its parent()
+    const std::string& nameInParent() const { return nameInParent_; }
+
+    //! set a hook that is notified about every change anywhere
+    //! in the object tree, in addition to the hooks of the
+    //! respective object. Pass nullptr to remove it.
+    static void setTreeHook(Hook* hook) { treeHook_ = hook; }
+
     void addChildDoc(const std::string &name, HasDocumentation* doc);
     const HasDocumentation* childDoc(const std::string& child);
 
@@ -92,6 +121,16 @@ public:
 
     std::map<std::string, Object*> children();
 
+    /** call the given function for all children whose name starts with
+     * the given prefix. In contrast to children(), this does not copy
+     * the map of children and skips the children with other names.
+     */
+    void childrenWithPrefix(const std::string& prefix,
+                            std::function<void(const std::string&, Object*)> onChild);
+    //! call the given function for all attributes whose name starts with the prefix
+    void attributesWithPrefix(const std::string& prefix,
+                              std::function<void(Attribute*)> onAttribute);
+
     void printTree(Output output, std::string rootLabel);
 
 protected:
@@ -105,6 +144,15 @@ protected:
     std::map<std::string, HasDocumentation*> childrenDoc_;
     std::vector<Hook*> hooks_;
 
+private:
+    void setParent(Object* parent, const std::string& name);
+    Object* parent_ = nullptr;
+    std::string nameInParent_;
+    //! the children whose parent() is this object
+    std::set<Object*> ownedChildren_;
+    static Hook* treeHook_;
+    static unsigned long treeGeneration_;
+
     //DynamicAttribute nameAttribute_;
 };
 
@@ -0,0 +1,149 @@
+#include "objectdump.h"
+
+#include <cstdio>
+
+#include "attribute.h"
+#include "object.h"
+
+using std::string;
+
+template<> Finite<DumpFormat>::ValueList Finite<DumpFormat>::values = ValueListPlain {
+    { DumpFormat::json, "json" },
+    { DumpFormat::binary, "binary" },
+};
+
+ObjectDump::ObjectDump(DumpFormat format, std::ostream& output)
+    : format_(format)
+    , output_(output)
+{
+    if (format_ == DumpFormat::json) {
+        output_ << '{';
+    }
+}
+
+void ObjectDump::add(const string& path, Object* object)
+{
+    separator();
+    if (format_ == DumpFormat::json) {
+        writeJsonString(output_, path);
+        output_ << ':';
+    }
+    writeObject(path, object);
+}
+
+void ObjectDump::add(const string& path, Attribute* attribute)
+{
+    separator();
+    if (format_ == DumpFormat::json) {
+        writeJsonString(output_, path);
+        output_ << ':';
+    }
+    writeAttribute(path, attribute);
+}
+
+void ObjectDump::finish()
+{
+    if (format_ == DumpFormat::json) {
+        output_ << "}\n";
+    }
+}
+
+//! print the separator between two top-level entries
+void ObjectDump::separator()
+{
+    if (!firstEntry_ && format_ == DumpFormat::json) {
+        output_ << ',';
+    }
+    firstEntry_ = false;
+}
+
+void ObjectDump::writeObject(const string& path, Object* object)
+{
+    string prefix = path.empty() ? "" : (path + OBJECT_PATH_SEPARATOR);
+    if (format_ == DumpFormat::binary) {
+        writeRecord(path, "object", "");
+        for (const auto& it : object->attributes()) {
+            writeAttribute(prefix + it.first, it.second);
+        }
+        for (const auto& it : object->children()) {
+            writeObject(prefix + it.first, it.second);
+        }
+        return;
+    }
+    output_ << "{\"attributes\":{";
+    bool first = true;
+    for (const auto& it : object->attributes()) {
+        if (!first) {
+            output_ << ',';
+        }
+        first = false;
+        writeJsonString(output_, it.first);
+        output_ << ':';
+        writeAttribute(prefix + it.first, it.second);
+    }
+    output_ << "},\"children\":{";
+    first = true;
+    for (const auto& it : object->children()) {
+        if (!first) {
+            output_ << ',';
+        }
+        first = false;
+        writeJsonString(output_, it.first);
+        output_ << ':';
+        writeObject(prefix + it.first, it.second);
+    }
+    output_ << "}}";
+}
+
+void ObjectDump::writeAttribute(const string& path, Attribute* attribute)
+{
+    if (format_ == DumpFormat::binary) {
+        writeRecord(path, attribute->typestr(), attribute->str());
+        return;
+    }
+    output_ << "{\"type\":";
+    writeJsonString(output_, attribute->typestr());
+    output_ << ",\"value\":";
+    writeJsonString(output_, attribute->str());
+    output_ << '}';
+}
+
+void ObjectDump::writeRecord(const string& path, const string& type, const string& value)
+{
+    writeNetstring(path);
+    writeNetstring(type);
+    writeNetstring(value);
+}
+
+void ObjectDump::writeNetstring(const string& str)
+{
+    output_ << str.size() << ':' << str << ',';
+}
+
+/**
+ * @brief write a string as a json string literal. Bytes beyond ASCII
+ * are copied literally, so valid UTF-8 stays valid UTF-8.
+ */
+void ObjectDump::writeJsonString(std::ostream& output, const string& str)
+{
+    output << '"';
+    for (char ch : str) {
+        switch (ch) {
+            case '"': output << "\\\""; break;
+            case '\\': output << "\\\\"; break;
+            case '\n': output << "\\n"; break;
+            case '\t': output << "\\t"; break;
+            case '\r': output << "\\r"; break;
+            default:
+                if (static_cast<unsigned char>(ch) < 0x20) {
+                    char buf[8];
+                    snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(ch));
+                    output << buf;
+                } else {
+                    output << ch;
+                }
+                break;
+        }
+    }
+    output << '"';
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+
+#include "finite.h"
+
+class Attribute;
+class Object;
+
+enum class DumpFormat {
+    json,
+    binary,
+};
+
+template <>
+struct is_finite<DumpFormat> : std::true_type {};
+template<> Finite<DumpFormat>::ValueList Finite<DumpFormat>::values;
+
+/**
+ * @brief Serialize objects (with all their attributes and children,
+ * recursively) and single attributes in a machine readable format. The
+ * data is written to the output stream while traversing the object tree.
+ *
+ * In the json format, the entries passed to add() are the keys of a
+ * json object. An object is serialized as
+ *
+ *     {"attributes":{NAME:ATTRIBUTE,...},"children":{NAME:OBJECT,...}}
+ *
+ * and an attribute as {"type":TYPE,"value":VALUE}, where TYPE is the
+ * type name as printed by attr_type and VALUE is the value as printed
+ * by get_attr.
+ *
+ * In the binary format, every object and every attribute is one record
+ * of three netstrings ("LENGTH:BYTES,"): the full path, the type (which
+ * is "object" for objects) and the value (which is empty for objects).
+ * Records of children follow the record of their parent object.
+ */
+class ObjectDump {
+public:
+    ObjectDump(DumpFormat format, std::ostream& output);
+    void add(const std::string& path, Object* object);
+    void add(const std::string& path, Attribute* attribute);
+    //! finish the output, after all entries have been added
+    void finish();
+    static void writeJsonString(std::ostream& output, const std::string& str);
+private:
+    void separator();
+    void writeObject(const std::string& path, Object* object);
+    void writeAttribute(const std::string& path, Attribute* attribute);
+    void writeRecord(const std::string& path,
+                     const std::string& type,
+                     const std::string& value);
+    void writeNetstring(const std::string& str);
+
+    DumpFormat format_;
+    std::ostream& output_;
+    bool firstEntry_ = true;
+};
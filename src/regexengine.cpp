@@ -0,0 +1,590 @@
+#include "regexengine.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <cstring>
+#include <locale>
+#include <map>
+#include <vector>
+
+using std::bitset;
+using std::make_shared;
+using std::map;
+using std::pair;
+using std::string;
+using std::vector;
+
+namespace {
+
+using CharSet = bitset<256>;
+
+/**
+ * @brief thrown by the parser if a regex is not supported
+ * by the automaton. This includes syntax errors, for
+ * which then std::regex generates the error message.
+ */
+class Unsupported {};
+
+//! the syntax tree of a regex
+class RegexNode {
+public:
+    enum class Type {
+        Chars, //! a single character out of a set
+        Concat,
+        Alternation,
+        Repeat,
+        LineBegin,
+        LineEnd,
+    };
+    Type type = Type::Concat;
+    CharSet chars;
+    vector<RegexNode> children;
+    int min = 0; //! for Repeat
+    int max = -1; //! for Repeat, -1 for unbounded
+};
+
+/**
+ * @brief A parser for the POSIX extended regular expressions
+ * as understood by std::regex::extended. Whenever the parser
+ * is not sure whether std::regex treats a construct the
+ * same way, it throws Unsupported.
+ */
+class RegexParser {
+public:
+    RegexParser(const string& source) : source_(source) {}
+    RegexNode parse() {
+        RegexNode root = parseAlternation();
+        if (!atEnd()) {
+            // an unmatched ')'
+            throw Unsupported();
+        }
+        return root;
+    }
+private:
+    bool atEnd() const { return pos_ >= source_.size(); }
+    char peek() const { return source_[pos_]; }
+    RegexNode parseAlternation();
+    RegexNode parseBranch();
+    RegexNode parseAtom();
+    bool parseQuantifier(RegexNode& node);
+    int parseNumber();
+    CharSet parseBracket();
+    static RegexNode charsNode(const CharSet& chars);
+
+    static const int maxRepeat_ = 255;
+    const string& source_;
+    size_t pos_ = 0;
+};
+
+RegexNode RegexParser::parseAlternation()
+{
+    RegexNode node;
+    node.type = RegexNode::Type::Alternation;
+    node.children.push_back(parseBranch());
+    while (!atEnd() && peek() == '|') {
+        pos_++;
+        node.children.push_back(parseBranch());
+    }
+    if (node.children.size() == 1) {
+        return node.children[0];
+    }
+    return node;
+}
+
+RegexNode RegexParser::parseBranch()
+{
+    RegexNode node;
+    node.type = RegexNode::Type::Concat;
+    while (!atEnd() && peek() != '|' && peek() != ')') {
+        RegexNode atom = parseAtom();
+        while (parseQuantifier(atom)) {
+        }
+        node.children.push_back(atom);
+    }
+    if (node.children.empty()) {
+        // empty branches are not allowed by POSIX
+        throw Unsupported();
+    }
+    if (node.children.size() == 1) {
+        return node.children[0];
+    }
+    return node;
+}
+
+RegexNode RegexParser::charsNode(const CharSet& chars)
+{
+    RegexNode node;
+    node.type = RegexNode::Type::Chars;
+    node.chars = chars;
+    return node;
+}
+
+RegexNode RegexParser::parseAtom()
+{
+    char c = source_[pos_++];
+    CharSet chars;
+    switch (c) {
+    case '(': {
+        if (atEnd()) {
+            throw Unsupported();
+        }
+        RegexNode inner = parseAlternation();
+        if (atEnd() || peek() != ')') {
+            throw Unsupported();
+        }
+        pos_++;
+        return inner;
+    }
+    case '.':
+        // as for std::regex, this matches everything but the null character
+        chars.set();
+        chars.reset(0);
+        return charsNode(chars);
+    case '[':
+        return charsNode(parseBracket());
+    case '^': {
+        RegexNode node;
+        node.type = RegexNode::Type::LineBegin;
+        return node;
+    }
+    case '$': {
+        RegexNode node;
+        node.type = RegexNode::Type::LineEnd;
+        return node;
+    }
+    case '\\': {
+        if (atEnd()) {
+            throw Unsupported();
+        }
+        char escaped = source_[pos_++];
+        if (escaped == '\0' || !strchr(".[()*+?{|^$\\", escaped)) {
+            throw Unsupported();
+        }
+        chars.set(static_cast<unsigned char>(escaped));
+        return charsNode(chars);
+    }
+    case '*':
+    case '+':
+    case '?':
+    case '{':
+    case '}':
+    case ']':
+    case ')':
+        throw Unsupported();
+    default:
+        chars.set(static_cast<unsigned char>(c));
+        return charsNode(chars);
+    }
+}
+
+bool RegexParser::parseQuantifier(RegexNode& node)
+{
+    if (atEnd()) {
+        return false;
+    }
+    int min = 0;
+    int max = -1;
+    switch (peek()) {
+    case '*': pos_++; break;
+    case '+': pos_++; min = 1; break;
+    case '?': pos_++; max = 1; break;
+    case '{':
+        pos_++;
+        min = parseNumber();
+        if (!atEnd() && peek() == ',') {
+            pos_++;
+            if (atEnd() || peek() != '}') {
+                max = parseNumber();
+            }
+        } else {
+            max = min;
+        }
+        if (atEnd() || peek() != '}') {
+            throw Unsupported();
+        }
+        pos_++;
+        if (min > maxRepeat_ || max > maxRepeat_ || (max >= 0 && min > max)) {
+            throw Unsupported();
+        }
+        break;
+    default:
+        return false;
+    }
+    if (node.type == RegexNode::Type::LineBegin
+        || node.type == RegexNode::Type::LineEnd)
+    {
+        throw Unsupported();
+    }
+    RegexNode repeat;
+    repeat.type = RegexNode::Type::Repeat;
+    repeat.min = min;
+    repeat.max = max;
+    repeat.children.push_back(node);
+    node = repeat;
+    return true;
+}
+
+int RegexParser::parseNumber()
+{
+    if (atEnd() || !isdigit(static_cast<unsigned char>(peek()))) {
+        throw Unsupported();
+    }
+    int number = 0;
+    while (!atEnd() && isdigit(static_cast<unsigned char>(peek()))) {
+        number = std::min(10 * number + (peek() - '0'), maxRepeat_ + 1);
+        pos_++;
+    }
+    return number;
+}
+
+/**
+ * @brief parse a bracket expression, after its opening '['
+ */
+CharSet RegexParser::parseBracket()
+{
+    static const map<string, std::ctype_base::mask> classes = {
+        { "alnum", std::ctype_base::alnum },
+        { "alpha", std::ctype_base::alpha },
+        { "blank", std::ctype_base::blank },
+        { "cntrl", std::ctype_base::cntrl },
+        { "digit", std::ctype_base::digit },
+        { "graph", std::ctype_base::graph },
+        { "lower", std::ctype_base::lower },
+        { "print", std::ctype_base::print },
+        { "punct", std::ctype_base::punct },
+        { "space", std::ctype_base::space },
+        { "upper", std::ctype_base::upper },
+        { "xdigit", std::ctype_base::xdigit },
+    };
+    CharSet chars;
+    bool negated = false;
+    if (!atEnd() && peek() == '^') {
+        negated = true;
+        pos_++;
+    }
+    bool first = true;
+    while (true) {
+        if (atEnd()) {
+            throw Unsupported();
+        }
+        char c = peek();
+        if (c == ']' && !first) {
+            pos_++;
+            break;
+        }
+        if (c == '[' && pos_ + 1 < source_.size()
+            && strchr(":.=", source_[pos_ + 1]))
+        {
+            if (source_[pos_ + 1] != ':') {
+                // collating elements and equivalence classes
+                throw Unsupported();
+            }
+            size_t end = source_.find(":]", pos_ + 2);
+            if (end == string::npos) {
+                throw Unsupported();
+            }
+            auto it = classes.find(source_.substr(pos_ + 2, end - pos_ - 2));
+            if (it == classes.end()) {
+                throw Unsupported();
+            }
+            auto& ctype = std::use_facet<std::ctype<char>>(std::locale());
+            for (int i = 0; i < 256; i++) {
+                if (ctype.is(it->second, static_cast<char>(i))) {
+                    chars.set(i);
+                }
+            }
+            pos_ = end + 2;
+            if (!atEnd() && peek() == '-'
+                && pos_ + 1 < source_.size() && source_[pos_ + 1] != ']')
+            {
+                // a class can not be the start of a range
+                throw Unsupported();
+            }
+            first = false;
+            continue;
+        }
+        if (c == '\\' || (c == '-' && !first
+                          && pos_ + 1 < source_.size() && source_[pos_ + 1] != ']'))
+        {
+            throw Unsupported();
+        }
+        first = false;
+        pos_++;
+        unsigned int low = static_cast<unsigned char>(c);
+        if (pos_ + 1 < source_.size() && peek() == '-' && source_[pos_ + 1] != ']') {
+            char highChar = source_[pos_ + 1];
+            unsigned int high = static_cast<unsigned char>(highChar);
+            if (highChar == '[' || highChar == '\\'
+                || low >= 128 || high >= 128 || low > high)
+            {
+                throw Unsupported();
+            }
+            pos_ += 2;
+            for (unsigned int i = low; i <= high; i++) {
+                chars.set(i);
+            }
+        } else {
+            chars.set(low);
+        }
+    }
+    if (negated) {
+        chars.flip();
+    }
+    return chars;
+}
+
+}
+
+/**
+ * @brief A nondeterministic finite automaton with epsilon edges for
+ * a regex. The deterministic automaton (DFA) is constructed lazily
+ * while matching strings, where every DFA state is a set of NFA states.
+ */
+class RegexEngine::Automaton {
+public:
+    Automaton(const RegexNode& root);
+    bool matches(const string& str);
+private:
+    enum class Edge {
+        Plain,
+        LineBegin, //! may only be used at the beginning of the string
+        LineEnd, //! may only be used at the end of the string
+    };
+    class State {
+    public:
+        CharSet chars; //! the characters leading to charTarget
+        int charTarget = -1;
+        vector<pair<Edge, int>> epsilon;
+    };
+    class DfaState {
+    public:
+        vector<int> nfaStates;
+        bool acceptsAtEnd = false;
+        int next[256]; //! the DFA state for a given char, or -1 if unknown
+    };
+    int newState();
+    int compile(const RegexNode& node, int from);
+    vector<int> closure(const vector<int>& states, bool lineBegin, bool lineEnd) const;
+    bool accepts(const vector<int>& states, bool lineBegin) const;
+    int dfaState(const vector<int>& nfaStates);
+    int dfaStep(int dfaIdx, unsigned char c);
+
+    static const size_t maxStates_ = 10000;
+    static const size_t maxDfaStates_ = 500;
+    vector<State> states_;
+    int start_ = 0;
+    int final_ = 0;
+    vector<DfaState> dfa_;
+    map<vector<int>, int> dfaIndex_;
+    int dfaStart_ = -1;
+};
+
+RegexEngine::Automaton::Automaton(const RegexNode& root)
+{
+    start_ = newState();
+    final_ = compile(root, start_);
+}
+
+int RegexEngine::Automaton::newState()
+{
+    if (states_.size() >= maxStates_) {
+        throw Unsupported();
+    }
+    states_.push_back({});
+    return static_cast<int>(states_.size()) - 1;
+}
+
+/**
+ * @brief add states and edges for the given node
+ * @param from the state from which the node is matched
+ * @return the state reached after matching the node
+ */
+int RegexEngine::Automaton::compile(const RegexNode& node, int from)
+{
+    switch (node.type) {
+    case RegexNode::Type::Chars: {
+        int target = newState();
+        if (states_[from].charTarget >= 0) {
+            int intermediate = newState();
+            states_[from].epsilon.push_back({Edge::Plain, intermediate});
+            from = intermediate;
+        }
+        states_[from].chars = node.chars;
+        states_[from].charTarget = target;
+        return target;
+    }
+    case RegexNode::Type::Concat: {
+        int current = from;
+        for (const auto& child : node.children) {
+            current = compile(child, current);
+        }
+        return current;
+    }
+    case RegexNode::Type::Alternation: {
+        int end = newState();
+        for (const auto& child : node.children) {
+            int branch = newState();
+            states_[from].epsilon.push_back({Edge::Plain, branch});
+            int branchEnd = compile(child, branch);
+            states_[branchEnd].epsilon.push_back({Edge::Plain, end});
+        }
+        return end;
+    }
+    case RegexNode::Type::Repeat: {
+        const RegexNode& child = node.children[0];
+        int current = from;
+        for (int i = 0; i < node.min; i++) {
+            current = compile(child, current);
+        }
+        if (node.max < 0) {
+            int loop = newState();
+            states_[current].epsilon.push_back({Edge::Plain, loop});
+            int loopEnd = compile(child, loop);
+            states_[loopEnd].epsilon.push_back({Edge::Plain, loop});
+            return loop;
+        }
+        int end = newState();
+        for (int i = node.min; i < node.max; i++) {
+            states_[current].epsilon.push_back({Edge::Plain, end});
+            current = compile(child, current);
+        }
+        states_[current].epsilon.push_back({Edge::Plain, end});
+        return end;
+    }
+    case RegexNode::Type::LineBegin:
+    case RegexNode::Type::LineEnd: {
+        int target = newState();
+        Edge edge = (node.type == RegexNode::Type::LineBegin)
+                ? Edge::LineBegin : Edge::LineEnd;
+        states_[from].epsilon.push_back({edge, target});
+        return target;
+    }
+    }
+    return from;
+}
+
+/**
+ * @brief all states reachable via epsilon edges. In order to
+ * keep the number of DFA states small, the result only contains
+ * the states that are relevant for further matching.
+ */
+vector<int> RegexEngine::Automaton::closure(const vector<int>& states,
+                                            bool lineBegin, bool lineEnd) const
+{
+    vector<char> visited(states_.size(), 0);
+    vector<int> stack = states;
+    vector<int> result;
+    while (!stack.empty()) {
+        int s = stack.back();
+        stack.pop_back();
+        if (visited[s]) {
+            continue;
+        }
+        visited[s] = 1;
+        bool relevant = states_[s].charTarget >= 0 || s == final_;
+        for (const auto& edge : states_[s].epsilon) {
+            if (edge.first == Edge::Plain
+                || (edge.first == Edge::LineBegin && lineBegin)
+                || (edge.first == Edge::LineEnd && lineEnd))
+            {
+                stack.push_back(edge.second);
+            } else {
+                // the edge may be usable later
+                relevant = true;
+            }
+        }
+        if (relevant) {
+            result.push_back(s);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+//! whether the final state is reachable at the end of the string
+bool RegexEngine::Automaton::accepts(const vector<int>& states, bool lineBegin) const
+{
+    auto reachable = closure(states, lineBegin, true);
+    return std::binary_search(reachable.begin(), reachable.end(), final_);
+}
+
+int RegexEngine::Automaton::dfaState(const vector<int>& nfaStates)
+{
+    auto it = dfaIndex_.find(nfaStates);
+    if (it != dfaIndex_.end()) {
+        return it->second;
+    }
+    dfa_.push_back({});
+    DfaState& state = dfa_.back();
+    state.nfaStates = nfaStates;
+    state.acceptsAtEnd = accepts(nfaStates, false);
+    std::fill(state.next, state.next + 256, -1);
+    int idx = static_cast<int>(dfa_.size()) - 1;
+    dfaIndex_[nfaStates] = idx;
+    return idx;
+}
+
+int RegexEngine::Automaton::dfaStep(int dfaIdx, unsigned char c)
+{
+    int known = dfa_[dfaIdx].next[c];
+    if (known >= 0) {
+        return known;
+    }
+    vector<int> targets;
+    for (int s : dfa_[dfaIdx].nfaStates) {
+        if (states_[s].chars.test(c)) {
+            targets.push_back(states_[s].charTarget);
+        }
+    }
+    targets = closure(targets, false, false);
+    if (dfa_.size() >= maxDfaStates_) {
+        // keep memory bounded by starting from scratch
+        vector<int> current = dfa_[dfaIdx].nfaStates;
+        dfa_.clear();
+        dfaIndex_.clear();
+        dfaStart_ = -1;
+        dfaIdx = dfaState(current);
+    }
+    int next = dfaState(targets);
+    dfa_[dfaIdx].next[c] = next;
+    return next;
+}
+
+bool RegexEngine::Automaton::matches(const string& str)
+{
+    if (str.empty()) {
+        return accepts({start_}, true);
+    }
+    if (dfaStart_ < 0) {
+        dfaStart_ = dfaState(closure({start_}, true, false));
+    }
+    int current = dfaStart_;
+    for (char c : str) {
+        current = dfaStep(current, static_cast<unsigned char>(c));
+        if (dfa_[current].nfaStates.empty()) {
+            return false;
+        }
+    }
+    return dfa_[current].acceptsAtEnd;
+}
+
+RegexEngine::RegexEngine(const string& source)
+{
+    try {
+        automaton_ = make_shared<Automaton>(RegexParser(source).parse());
+    } catch (const Unsupported&) {
+        fallback_ = make_shared<std::regex>(source, std::regex::extended);
+    }
+}
+
+bool RegexEngine::matches(const string& str) const
+{
+    if (automaton_) {
+        return automaton_->matches(str);
+    }
+    if (fallback_) {
+        return std::regex_match(str, *fallback_);
+    }
+    return false;
+}
@@ -0,0 +1,40 @@
+#ifndef REGEXENGINE_H
+#define REGEXENGINE_H
+
+#include <memory>
+#include <regex>
+#include <string>
+
+/**
+ * @brief A compiled POSIX extended regular expression that is only
+ * used for full matches, i.e. std::regex_match().
+ *
+ * The regex is translated to a finite automaton whose deterministic
+ * version is built lazily while matching, so matching takes linear time
+ * and repeated matching is a mere table lookup per byte. Patterns
+ * containing constructs that the automaton does not cover (e.g. back
+ * references, collating elements, or any syntax error) are handed to
+ * std::regex instead, so the accepted syntax, the error messages and
+ * the semantics are exactly those of std::regex.
+ */
+class RegexEngine {
+public:
+    //! a regex that does not match anything
+    RegexEngine() = default;
+    /** compile the given extended regex
+     *
+     * may throw a std::regex_error exception
+     */
+    explicit RegexEngine(const std::string& source);
+    //! whether the entire given string matches the regex
+    bool matches(const std::string& str) const;
+    //! whether the regex is matched by the automaton (and not by std::regex)
+    bool usesAutomaton() const { return automaton_ != nullptr; }
+private:
+    class Automaton;
+    // exactly one of these is set for a compiled regex
+    std::shared_ptr<Automaton> automaton_;
+    std::shared_ptr<std::regex> fallback_;
+};
+
+#endif // REGEXENGINE_H
@@ -16,7 +16,7 @@ RegexStr RegexStr::fromStr(const string& source)
     // => So we must not compile "" to a regex
     if (!source.empty()) {
         try {
-            r.regex_ = std::regex(source, std::regex::extended);
+            r.regex_ = RegexEngine(source);
         }  catch (const std::exception& e) {
             throw std::invalid_argument(e.what());
         }
@@ -34,7 +34,7 @@ bool RegexStr::matches(const string& str) const
     if (source_.empty()) {
         return false;
     } else {
-        return std::regex_match(str, regex_);
+        return regex_.matches(str);
     }
 }
 
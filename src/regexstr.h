@@ -1,10 +1,9 @@
 #ifndef REGEXSTR_H
 #define REGEXSTR_H
 
-#include <regex>
-
 #include "attribute_.h"
 #include "converter.h"
+#include "regexengine.h"
 
 /** wrapper class for extended regexes that remembers
  * its source string
@@ -31,7 +30,7 @@ public:
     bool matches(const std::string& str) const;
 private:
     std::string source_;
-    std::regex regex_;
+    RegexEngine regex_;
 };
 
 template<> RegexStr Converter<RegexStr>::parse(const std::string& source);
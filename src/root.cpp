@@ -3,13 +3,16 @@
 #include <memory>
 
 #include "autostart.h"
+#include "changejournal.h"
 #include "client.h"
 #include "clientmanager.h"
 #include "ewmh.h"
+#include "freezer.h"
 #include "globalcommands.h"
 #include "hlwmcommon.h"
 #include "keymanager.h"
 #include "layout.h"
+#include "macromanager.h"
 #include "metacommands.h"
 #include "monitormanager.h"
 #include "mousemanager.h"
@@ -19,6 +22,7 @@
 #include "tag.h"
 #include "tagmanager.h"
 #include "theme.h"
+#include "timermanager.h"
 #include "tmp.h"
 #include "typesdoc.h"
 #include "utils.h"
@@ -32,7 +36,10 @@ shared_ptr<Root> Root::root_;
 Root::Root(Globals g, XConnection& xconnection, Ewmh& ewmh, IpcServer& ipcServer)
     : autostart(*this, "autostart")
     , clients(*this, "clients")
+    , freeze(*this, "freeze")
+    , journal(*this, "journal")
     , keys(*this, "keys")
+    , macros(*this, "macros")
     , monitors(*this, "monitors")
     , mouse(*this, "mouse")
     , panels(*this, "panels")
@@ -40,6 +47,7 @@ Root::Root(Globals g, XConnection& xconnection, Ewmh& ewmh, IpcServer& ipcServer
     , settings(*this, "settings")
     , tags(*this, "tags")
     , theme(*this, "theme")
+    , timers(*this, "timers")
     , tmp(*this, TMP_OBJECT_PATH)
     , types(*this, "types")
     , watchers(*this, "watchers")
@@ -54,7 +62,10 @@ Root::Root(Globals g, XConnection& xconnection, Ewmh& ewmh, IpcServer& ipcServer
     // initialize root children (alphabetically)
     autostart.init(g.autostartPath, g.globalAutostartPath);
     clients.init();
+    freeze.init();
+    journal.init();
     keys.init();
+    macros.init();
     monitors.init();
     mouse.init();
     panels.init(xconnection);
@@ -62,6 +73,7 @@ Root::Root(Globals g, XConnection& xconnection, Ewmh& ewmh, IpcServer& ipcServer
     settings.init();
     tags.init();
     theme.init();
+    timers.init();
     tmp.init();
     types.init();
     watchers.init();
@@ -73,8 +85,10 @@ Root::Root(Globals g, XConnection& xconnection, Ewmh& ewmh, IpcServer& ipcServer
     clients->injectDependencies(settings(), theme(), &ewmh_);
     panels->injectDependencies(settings());
     monitors->injectDependencies(settings(), tags(), panels());
-    mouse->injectDependencies(clients(), tags(), monitors());
+    mouse->injectDependencies(clients(), tags(), monitors(), settings());
     watchers->injectDependencies(this);
+    journal->injectDependencies(this);
+    freeze->injectDependencies(monitors(), &ewmh_, &ipcServer_);
 
     // set temporary globals
     ::global_tags = tags();
@@ -99,6 +113,9 @@ Root::Root(Globals g, XConnection& xconnection, Ewmh& ewmh, IpcServer& ipcServer
     keys->keyComboActive.connect(xKeyGrabber_.get(), &XKeyGrabber::grabKeyCombo);
     keys->keyComboInactive.connect(xKeyGrabber_.get(), &XKeyGrabber::ungrabKeyCombo);
     keys->keyComboAllInactive.connect(xKeyGrabber_.get(), &XKeyGrabber::ungrabAll);
+    keys->keyComboBatchFinished.connect(xKeyGrabber_.get(), &XKeyGrabber::applyGrabs);
+    keys->keyChordStarted.connect(xKeyGrabber_.get(), &XKeyGrabber::grabKeyboard);
+    keys->keyChordFinished.connect(xKeyGrabber_.get(), &XKeyGrabber::ungrabKeyboard);
 }
 
 Root::~Root() {
@@ -106,7 +123,10 @@ Root::~Root() {
 
 void Root::shutdown()
 {
+    // do not record the changes while tearing down the tree
+    journal->injectDependencies(nullptr);
     // Note: delete in reverse order of initialization!
+    freeze.reset(); // refers to monitors
     mouse.reset();
     // ClientManager and MonitorManager have circular dependencies, but only
     // MonitorManager needs the other for shutting down, so we do that first:
@@ -119,10 +139,13 @@ void Root::shutdown()
     tags.reset();
 
     // For the rest, order does not matter (do it alphabetically):
+    journal.reset();
     keys.reset();
+    macros.reset();
     rules.reset();
     settings.reset();
     theme.reset();
+    timers.reset();
     tmp.reset();
 
     children_.clear(); // avoid possible circular shared_ptr dependency
@@ -9,13 +9,16 @@
 // new object tree root.
 
 class Autostart;
+class ChangeJournal; // IWYU pragma: keep
 class ClientManager; // IWYU pragma: keep
 class Ewmh;
 class FrameLeaf;
+class Freezer; // IWYU pragma: keep
 class GlobalCommands;
 class HlwmCommon;
 class IpcServer;
 class KeyManager; // IWYU pragma: keep
+class MacroManager; // IWYU pragma: keep
 class MonitorManager; // IWYU pragma: keep
 class MouseManager; // IWYU pragma: keep
 class PanelManager;
@@ -24,6 +27,7 @@ class RuleManager; // IWYU pragma: keep
 class Settings; // IWYU pragma: keep
 class TagManager; // IWYU pragma: keep
 class Theme; // IWYU pragma: keep
+class TimerManager; // IWYU pragma: keep
 class Tmp; // IWYU pragma: keep
 class TypesDoc; // IWYU pragma: keep
 class Watchers;
@@ -58,7 +62,10 @@ public:
     // (in alphabetical order)
     Child_<Autostart> autostart;
     Child_<ClientManager> clients;
+    Child_<Freezer> freeze;
+    Child_<ChangeJournal> journal;
     Child_<KeyManager> keys;
+    Child_<MacroManager> macros;
     Child_<MonitorManager> monitors;
     Child_<MouseManager> mouse;
     Child_<PanelManager> panels;
@@ -66,6 +73,7 @@ public:
     Child_<Settings> settings;
     Child_<TagManager> tags;
     Child_<Theme> theme;
+    Child_<TimerManager> timers;
     Child_<Tmp> tmp;
     Child_<TypesDoc> types;
     Child_<Watchers> watchers;
@@ -1,17 +1,101 @@
 #include "rulemanager.h"
 
 #include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <string>
 
+#include "client.h"
 #include "completion.h"
+#include "ewmh.h"
 #include "globals.h"
 #include "ipc-protocol.h"
+#include "root.h"
 #include "utils.h"
+#include "xconnection.h"
 
 using std::string;
 using std::to_string;
 using std::endl;
 using std::unique_ptr;
+using std::vector;
+
+class RuleObject : public Object {
+public:
+    RuleObject(Rule& rule)
+        : label(this, "label", &RuleObject::getLabel)
+        , evaluationCount(this, "evaluation_count", &RuleObject::getEvaluationCount)
+        , matchCount(this, "match_count", &RuleObject::getMatchCount)
+        , evaluationTime(this, "evaluation_time", &RuleObject::getEvaluationTime)
+        , lastMatch(this, "last_match", &RuleObject::getLastMatch)
+        , rule_(rule)
+    {
+        setDoc("a rule, as listed by list_rules, together with "
+               "statistics about how often it was evaluated and matched. "
+               "A rule is only evaluated for a client if it can possibly match, "
+               "e.g. a rule with the condition class=Foo is only evaluated for "
+               "clients of the class Foo.");
+        label.setDoc("the label of the rule");
+        evaluationCount.setDoc("the number of times the rule was evaluated for a client");
+        matchCount.setDoc("the number of times the rule matched a client");
+        evaluationTime.setDoc("the total time spent on evaluating the rule, in microseconds");
+        lastMatch.setDoc("the window id of the client most recently "
+                         "matched by the rule, or 0x0 if the rule never matched");
+    }
+    DynAttribute_<string> label;
+    DynAttribute_<unsigned long> evaluationCount;
+    DynAttribute_<unsigned long> matchCount;
+    DynAttribute_<unsigned long> evaluationTime;
+    DynAttribute_<WindowID> lastMatch;
+private:
+    string getLabel() { return rule_.label; }
+    unsigned long getEvaluationCount() { return rule_.evaluationCount; }
+    unsigned long getMatchCount() { return rule_.matchCount; }
+    unsigned long getEvaluationTime() {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(rule_.evaluationTime);
+        return static_cast<unsigned long>(us.count());
+    }
+    WindowID getLastMatch() { return rule_.lastMatch; }
+    Rule& rule_;
+};
+
+RuleManager::RuleManager()
+    : count(this, "count", &RuleManager::getCount)
+{
+    setDoc("For every rule, there is an entry with its index "
+           "in the order of evaluation (as in list_rules).");
+    count.setDoc("the number of rules");
+}
+
+RuleManager::~RuleManager()
+{
+}
+
+/**
+ * @brief The client properties for which conditions with an exact value
+ * are indexed. For a given client, a function returns false if
+ * the client has no value for this property (such that no condition
+ * on this property can match), and otherwise the value.
+ */
+const std::map<string, RuleManager::IndexedProperty> RuleManager::indexedProperties = {
+    { "class", [](const Client* client, string& value) {
+        value = Root::get()->X.getClass(client->x11Window());
+        return true;
+    }},
+    { "instance", [](const Client* client, string& value) {
+        value = Root::get()->X.getInstance(client->x11Window());
+        return true;
+    }},
+    { "windowtype", [](const Client* client, string& value) {
+        auto& ewmh = Ewmh::get();
+        int wintype = ewmh.getWindowType(client->x11Window());
+        if (wintype < 0) {
+            return false;
+        }
+        value = ewmh.netatomName(wintype);
+        return true;
+    }},
+};
 
 /**
  * @brief RuleManager::parseRule
@@ -144,8 +228,8 @@ int RuleManager::addRuleCommand(Input input, Output output) {
     rule_label_index_++;
 
     // Insert rule into list according to "prepend" flag
-    auto insertAt = prepend ? rules_.begin() : rules_.end();
-    rules_.insert(insertAt, make_unique<Rule>(rule));
+    RuleKey key = prepend ? --firstKey_ : ++lastKey_;
+    insertRule(key, make_unique<Rule>(rule));
 
     return HERBST_EXIT_SUCCESS;
 }
@@ -160,7 +244,7 @@ int RuleManager::unruleCommand(Input input, Output output) {
     }
 
     if (arg == "--all" || arg == "-F") {
-        rules_.clear();
+        clearRules();
         rule_label_index_ = 0;
     } else {
         // Remove rule specified by argument
@@ -178,8 +262,8 @@ int RuleManager::unruleCommand(Input input, Output output) {
  * Implements the "list_rules" IPC command
  */
 int RuleManager::listRulesCommand(Output output) {
-    for (auto& rule : rules_) {
-        rule->print(output);
+    for (auto& it : rules_) {
+        it.second->print(output);
     }
 
     return HERBST_EXIT_SUCCESS;
@@ -194,8 +278,8 @@ size_t RuleManager::removeRules(string label) {
     auto countBefore = rules_.size();
 
     for (auto ruleIter = rules_.begin(); ruleIter != rules_.end();) {
-        if ((*ruleIter)->label == label) {
-            ruleIter = rules_.erase(ruleIter);
+        if (ruleIter->second->label == label) {
+            eraseRule(ruleIter++);
         } else {
             ruleIter++;
         }
@@ -203,7 +287,107 @@ size_t RuleManager::removeRules(string label) {
 
     auto countAfter = rules_.size();
 
-    return countAfter - countBefore;
+    return countBefore - countAfter;
+}
+
+/**
+ * @brief the condition by which the rule is indexed, i.e. a condition
+ * requiring an exact value for one of the indexedProperties. Returns
+ * nullptr if the rule needs to be evaluated for every client.
+ */
+const Condition* RuleManager::indexCondition(const Rule& rule)
+{
+    const Condition* result = nullptr;
+    for (const auto& cond : rule.conditions) {
+        if (cond.name == "maxage" && !cond.negated) {
+            // maxage must be evaluated for every client,
+            // because this lets the rule expire
+            return nullptr;
+        }
+        if (!result && !cond.negated
+            && cond.value_type == CONDITION_VALUE_TYPE_STRING
+            && indexedProperties.count(cond.name))
+        {
+            result = &cond;
+        }
+    }
+    return result;
+}
+
+void RuleManager::insertRule(RuleKey key, unique_ptr<Rule> rule)
+{
+    const Condition* cond = indexCondition(*rule);
+    if (cond) {
+        exactMatchIndex_[cond->name][cond->value_str].insert(key);
+    } else {
+        unindexedRules_.insert(key);
+    }
+    ruleObjects_[key] = make_unique<RuleObject>(*rule);
+    rules_[key] = std::move(rule);
+    ruleOrderChanged();
+}
+
+void RuleManager::eraseRule(std::map<RuleKey, unique_ptr<Rule>>::iterator it)
+{
+    const Condition* cond = indexCondition(*(it->second));
+    if (cond) {
+        auto& bucketsForProperty = exactMatchIndex_[cond->name];
+        auto bucket = bucketsForProperty.find(cond->value_str);
+        if (bucket != bucketsForProperty.end()) {
+            bucket->second.erase(it->first);
+            if (bucket->second.empty()) {
+                bucketsForProperty.erase(bucket);
+            }
+        }
+    } else {
+        unindexedRules_.erase(it->first);
+    }
+    ruleObjects_.erase(it->first);
+    rules_.erase(it);
+    ruleOrderChanged();
+}
+
+void RuleManager::clearRules()
+{
+    ruleObjects_.clear();
+    rules_.clear();
+    exactMatchIndex_.clear();
+    unindexedRules_.clear();
+    ruleOrderChanged();
+}
+
+/**
+ * @brief Called whenever rules are added or removed. The children
+ * rules.<index> are dynamic children that compute the rule at their
+ * index on access. So inserting or expiring a rule (possibly within
+ * evaluateRules()) does not need to rename the children of all
+ * following rules.
+ */
+void RuleManager::ruleOrderChanged()
+{
+    ruleObjectsByIndexOutdated_ = true;
+    for (; indexChildren_ < rules_.size(); indexChildren_++) {
+        size_t index = indexChildren_;
+        addDynamicChild([this, index]() -> Object* {
+            return ruleObjectAt(index);
+        }, to_string(index));
+    }
+}
+
+//! the object of the rule at the given index, or nullptr if there is none
+RuleObject* RuleManager::ruleObjectAt(size_t index)
+{
+    if (ruleObjectsByIndexOutdated_) {
+        ruleObjectsByIndexOutdated_ = false;
+        ruleObjectsByIndex_.clear();
+        for (const auto& it : ruleObjects_) {
+            ruleObjectsByIndex_.push_back(it.second.get());
+        }
+    }
+    if (index >= ruleObjectsByIndex_.size()) {
+        return nullptr;
+    }
+    return ruleObjectsByIndex_[index];
 }
 
 string RuleManager::stripDoubleHyphens(string arg) {
@@ -228,7 +412,7 @@ std::tuple<string, char, string> RuleManager::tokenizeArg(string arg) {
 void RuleManager::unruleCompletion(Completion& complete) {
     complete.full({ "-F", "--all" });
     for (auto& it : rules_) {
-        complete.full(it->label);
+        complete.full(it.second->label);
     }
 }
 
@@ -248,15 +432,35 @@ void RuleManager::addRuleCompletion(Completion& complete) {
 
 //! Evaluate rules against a given client
 ClientChanges RuleManager::evaluateRules(Client* client, Output output, ClientChanges changes) {
-    // go through all rules and remove those that expired.
-    // Here, we use erase + remove_if because it uses a Forward Iterator
-    // and so it is ensured that the rules are evaluated in the correct order.
-    auto forEachRule = [&](unique_ptr<Rule>& rule) {
-        rule->evaluate(client, changes, output);
-        return rule->expired();
-    };
-    rules_.erase(std::remove_if(rules_.begin(), rules_.end(), forEachRule),
-                 rules_.end());
+    // collect the rules that possibly match: all rules that are not indexed
+    // and those whose indexed condition holds for the client. All other
+    // rules do not match, so skipping them does not change anything.
+    vector<RuleKey> candidates(unindexedRules_.begin(), unindexedRules_.end());
+    for (const auto& property : exactMatchIndex_) {
+        if (property.second.empty()) {
+            continue;
+        }
+        string value;
+        if (!indexedProperties.at(property.first)(client, value)) {
+            continue;
+        }
+        auto bucket = property.second.find(value);
+        if (bucket != property.second.end()) {
+            candidates.insert(candidates.end(), bucket->second.begin(), bucket->second.end());
+        }
+    }
+    // evaluate them in the correct order and remove those that expired.
+    std::sort(candidates.begin(), candidates.end());
+    for (RuleKey key : candidates) {
+        auto it = rules_.find(key);
+        if (it == rules_.end()) {
+            continue;
+        }
+        it->second->evaluate(client, changes, output);
+        if (it->second->expired()) {
+            eraseRule(it);
+        }
+    }
     return changes;
 }
 
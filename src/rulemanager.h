@@ -1,13 +1,23 @@
 #pragma once
 
-#include <list>
+#include <functional>
+#include <map>
 #include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
 
+#include "attribute_.h"
 #include "object.h"
 #include "rules.h"
 
+class RuleObject;
+
 class RuleManager : public Object {
 public:
+    RuleManager();
+    virtual ~RuleManager();
+    DynAttribute_<unsigned long> count;
     int addRuleCommand(Input input, Output output);
     void addRuleCompletion(Completion& complete);
     int unruleCommand(Input input, Output output);
@@ -17,6 +27,16 @@ public:
     static int parseRule(Input input, Output output, Rule& rule, bool& prepend);
 
 private:
+    //! the position of a rule in the evaluation order
+    using RuleKey = long long;
+    using IndexedProperty = std::function<bool(const Client*, std::string&)>;
+    static const std::map<std::string, IndexedProperty> indexedProperties;
+    static const Condition* indexCondition(const Rule& rule);
+    void insertRule(RuleKey key, std::unique_ptr<Rule> rule);
+    void eraseRule(std::map<RuleKey, std::unique_ptr<Rule>>::iterator it);
+    void clearRules();
+    void ruleOrderChanged();
+    RuleObject* ruleObjectAt(size_t index);
     size_t removeRules(std::string label);
     static std::string stripDoubleHyphens(std::string arg);
     static std::tuple<std::string, char, std::string> tokenizeArg(std::string arg);
@@ -24,6 +44,25 @@ private:
     //! Ever-incrementing index for labeling new rules
     unsigned long long rule_label_index_ = 0;
 
-    //! Currently active rules
-    std::list<std::unique_ptr<Rule>> rules_;
+    //! Currently active rules, in the order of evaluation
+    std::map<RuleKey, std::unique_ptr<Rule>> rules_;
+    RuleKey firstKey_ = 0;
+    RuleKey lastKey_ = 0;
+    //! the objects rules.<index> exposing each rule's statistics
+    std::map<RuleKey, std::unique_ptr<RuleObject>> ruleObjects_;
+    //! the entries of ruleObjects_ by index, computed on demand
+    std::vector<RuleObject*> ruleObjectsByIndex_;
+    bool ruleObjectsByIndexOutdated_ = false;
+    //! the number of dynamic children rules.<index> created so far
+    size_t indexChildren_ = 0;
+    unsigned long getCount() const {
+        return static_cast<unsigned long>(rules_.size());
+    }
+
+    /** For rules requiring an exact value of one of the indexedProperties,
+     * this maps property name -> value -> keys of such rules. All other
+     * rules are in unindexedRules_ and need to be evaluated for every client.
+     */
+    std::map<std::string, std::unordered_map<std::string, std::set<RuleKey>>> exactMatchIndex_;
+    std::set<RuleKey> unindexedRules_;
 };
@@ -1,6 +1,7 @@
 #include "rules.h"
 
 #include <cstdio>
+#include <regex>
 
 #include "client.h"
 #include "ewmh.h"
@@ -113,7 +114,7 @@ bool Rule::addCondition(const Condition::Matchers::const_iterator& it, char op,
         case '~': {
             cond.value_type = CONDITION_VALUE_TYPE_REGEX;
             try {
-                cond.value_reg_exp = std::regex(value, std::regex::extended);
+                cond.value_reg_exp = RegexEngine(value);
             } catch(std::regex_error& err) {
                 output.perror() << "Cannot parse value \"" << value
                         << "\" from condition \"" << name
@@ -188,6 +189,7 @@ Rule::Rule() {
  */
 bool Rule::evaluate(Client* client, ClientChanges& changes, Output output)
 {
+    auto startTime = std::chrono::steady_clock::now();
     bool rule_match = true; // if entire rule matches
 
     // check all conditions
@@ -229,6 +231,12 @@ bool Rule::evaluate(Client* client, ClientChanges& changes, Output output)
     if (rule_match && once) {
         expired_ = true;
     }
+    evaluationCount++;
+    if (rule_match) {
+        matchCount++;
+        lastMatch = client->x11Window();
+    }
+    evaluationTime += std::chrono::steady_clock::now() - startTime;
     return rule_match;
 }
 
@@ -274,7 +282,7 @@ bool Condition::matches(const string& str) const {
             return value_str == str;
             break;
         case CONDITION_VALUE_TYPE_REGEX:
-            return std::regex_match(str, value_reg_exp);
+            return value_reg_exp.matches(str);
             break;
         case CONDITION_VALUE_TYPE_INTEGER:
             try {
@@ -1,13 +1,15 @@
 #ifndef __HS_RULES_H_
 #define __HS_RULES_H_
 
+#include <chrono>
 #include <functional>
-#include <regex>
 
 #include "converter.h"
 #include "finite.h"
 #include "optional.h"
+#include "regexengine.h"
 #include "regexstr.h"
+#include "x11-types.h"
 
 class Client;
 
@@ -35,7 +37,7 @@ public:
 
     std::string value_str;
     int value_integer = 0;
-    std::regex value_reg_exp;
+    RegexEngine value_reg_exp;
     std::string value_reg_str;
     Matcher match_;
 
@@ -149,6 +151,12 @@ public:
     bool once = false;
     time_t birth_time; // timestamp of at creation
 
+    // usage statistics, updated by evaluate()
+    unsigned long evaluationCount = 0;
+    unsigned long matchCount = 0;
+    std::chrono::steady_clock::duration evaluationTime = {};
+    Window lastMatch = 0; //! the last client matched by the rule, or 0
+
     bool setLabel(char op, std::string value, Output output);
     bool addCondition(const Condition::Matchers::const_iterator& it, char op, const char* value, bool negated, Output output);
     bool addConsequence(const Consequence::Appliers::const_iterator& it, const char* value, Output output);
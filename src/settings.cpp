@@ -117,6 +117,9 @@ Settings::Settings()
         &auto_detect_panels,
         &pseudotile_center_threshold,
         &update_dragged_clients,
+        &title_refresh_rate,
+        &drag_refresh_rate,
+        &keychord_timeout,
         &ellipsis,
         &tree_style,
         &wmname,
@@ -176,6 +179,24 @@ Settings::Settings()
         }
         return string();
     });
+    title_refresh_rate.setValidator([] (int new_value) {
+        if (new_value < 0) {
+            return string("title_refresh_rate must not be negative");
+        }
+        return string();
+    });
+    drag_refresh_rate.setValidator([] (int new_value) {
+        if (new_value < 0) {
+            return string("drag_refresh_rate must not be negative");
+        }
+        return string();
+    });
+    keychord_timeout.setValidator([] (int new_value) {
+        if (new_value < 0) {
+            return string("keychord_timeout must not be negative");
+        }
+        return string();
+    });
     g_settings = this;
     for (auto i : attributes()) {
         i.second->setWritable();
@@ -434,6 +455,29 @@ Settings::Settings()
                 "during resizing it with the mouse. If unset, the client\'s "
                 "content is resized after the mouse button is released.");
 
+    title_refresh_rate.setDoc(
+                "The maximum number of times per second the title of a "
+                "window is updated. If a window changes its title more "
+                "often, then the changes are coalesced and only the "
+                "latest title is shown (and reported via the hook "
+                "+window_title_changed+) at the end of each interval. "
+                "If set to 0, every title change is applied immediately.");
+
+    drag_refresh_rate.setDoc(
+                "The maximum number of times per second the geometry of a "
+                "window or frame is updated while dragging it with the "
+                "mouse (e.g. the refresh rate of the monitor). Faster "
+                "mouse motions are coalesced into the latest cursor "
+                "position, and the final position is always applied when "
+                "the mouse button is released. If set to 0, every mouse "
+                "motion is applied immediately.");
+
+    keychord_timeout.setDoc(
+                "The time in milliseconds after which a partially entered "
+                "key chord (see *keybind*) is aborted. If set to 0, a "
+                "pending key chord is only aborted by pressing a key "
+                "that does not continue the chord.");
+
     verbose.setDoc(
                 "If set, verbose output is logged to herbstluftwm\'s stderr. "
                 "The default value is controlled by the *--verbose* command "
@@ -0,0 +1,130 @@
+#include "floating.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+using std::pair;
+using std::vector;
+
+// The geometric part of the smart placement does not depend on the
+// window manager state, so it lives in its own translation unit and
+// is also linked into utilities/placementbench.
+
+/**
+ * @brief Find the position for a window of the given size within
+ * the area (0,0)-area such that the overlap with the given rectangles
+ * is as little as possible. The overlap with floating windows
+ * (rectangles whose second component is true) is minimized first, then
+ * the overlap with tiling windows.
+ *
+ * The candidate positions are those where one of the window's corners
+ * is at the corner of another rectangle or at the gap to the screen edge.
+ * For a fixed y coordinate, the overlap with a rectangle is a piecewise
+ * linear function in the x coordinate with four kinks. So the overlaps
+ * of all candidate x coordinates are computed in one sweep over the
+ * kinks, which are sorted only once. In total, this takes O(n^2) for n
+ * rectangles.
+ * @return the top left corner of the suggested position
+ */
+Point2D Floating::smartPlacement(const vector<pair<Rectangle, bool>>& rects,
+                                 Point2D size, Point2D area, int gap)
+{
+    // collect possible values for the x and y coordinates of
+    // one of the window corners
+    vector<int> xValues;
+    vector<int> yValues;
+    // use all corners of other windows
+    for (const auto& it : rects) {
+        xValues.push_back(it.first.x);
+        xValues.push_back(it.first.x + it.first.width);
+        yValues.push_back(it.first.y);
+        yValues.push_back(it.first.y + it.first.height);
+    }
+    // use screen corners
+    xValues.push_back(gap); // left
+    yValues.push_back(gap); // top
+    xValues.push_back(area.x); // right
+    yValues.push_back(area.y); // bottom
+
+    // interpret every value as the coordinate of the top/left or the
+    // bottom/right edge of the window and only keep those coordinates
+    // of the top left corner where the window is entirely within the
+    // screen area
+    auto topLeftCandidates = [](const vector<int>& values, int extent, int areaSize) {
+        vector<int> candidates;
+        for (int value : values) {
+            for (int coordinate : { value, value - extent }) {
+                if (coordinate >= 0 && coordinate + extent <= areaSize) {
+                    candidates.push_back(coordinate);
+                }
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                         candidates.end());
+        return candidates;
+    };
+    vector<int> xCandidates = topLeftCandidates(xValues, size.x, area.x);
+    vector<int> yCandidates = topLeftCandidates(yValues, size.y, area.y);
+
+    // With r(t) = max(t, 0), the length of the intersection of the
+    // intervals [x, x + size.x) and [a, b) is
+    //   r(x - a + size.x) - r(x - b + size.x) - r(x - a) + r(x - b)
+    // so it is the sum of four ramps starting at the following kinks.
+    struct Kink {
+        int position;
+        int sign;
+        size_t rectIdx;
+        bool operator<(const Kink& other) const {
+            return position < other.position;
+        }
+    };
+    vector<Kink> kinks;
+    for (size_t i = 0; size.x > 0 && i < rects.size(); i++) {
+        const Rectangle& r = rects[i].first;
+        if (r.width <= 0) {
+            continue;
+        }
+        kinks.push_back({ r.x - size.x, 1, i });
+        kinks.push_back({ r.x + r.width - size.x, -1, i });
+        kinks.push_back({ r.x, -1, i });
+        kinks.push_back({ r.x + r.width, 1, i });
+    }
+    std::sort(kinks.begin(), kinks.end());
+
+    // the overlap with floating windows, with tiling windows,
+    // and the topleft position:
+    std::tuple<long long, long long, Point2D> best {
+        std::numeric_limits<long long>::max(),
+        std::numeric_limits<long long>::max(),
+        Point2D { gap, gap }
+    };
+    // the height of the intersection with each rectangle
+    vector<long long> heights(rects.size());
+    for (int y : yCandidates) {
+        for (size_t i = 0; i < rects.size(); i++) {
+            const Rectangle& r = rects[i].first;
+            heights[i] = std::max(0, std::min(y + size.y, r.y + r.height)
+                                     - std::max(y, r.y));
+        }
+        // the overlap at x is slope * x - offset; index 0 is for
+        // floating windows, index 1 for tiling windows
+        long long slope[2] = { 0, 0 };
+        long long offset[2] = { 0, 0 };
+        auto kink = kinks.begin();
+        for (int x : xCandidates) {
+            for (; kink != kinks.end() && kink->position <= x; kink++) {
+                long long delta = kink->sign * heights[kink->rectIdx];
+                int group = rects[kink->rectIdx].second ? 0 : 1;
+                slope[group] += delta;
+                offset[group] += delta * kink->position;
+            }
+            auto t = std::make_tuple(slope[0] * x - offset[0],
+                                     slope[1] * x - offset[1],
+                                     Point2D { x, y });
+            best = std::min(best, t);
+        }
+    }
+    return std::get<2>(best);
+}
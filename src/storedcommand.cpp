@@ -0,0 +1,56 @@
+#include "storedcommand.h"
+
+#include "command.h"
+#include "ipc-protocol.h"
+#include "utils.h"
+
+using std::make_shared;
+using std::shared_ptr;
+using std::string;
+
+StoredCommand::StoredCommand(shared_ptr<const ArgList::Container> command)
+    : command_(this, "command", &StoredCommand::getCommand)
+    , argv_(command)
+{
+    command_.setDoc("the command (with its arguments) that is called, "
+                    "separated by spaces");
+}
+
+string StoredCommand::getCommand()
+{
+    return join_strings(*argv_, " ");
+}
+
+/**
+ * @brief check that the given name can be used as the name of a new
+ * child object
+ * @param the kind of the object, used in the error message
+ * @return 0 or an error code
+ */
+int StoredCommand::checkName(const string& name, const string& kind, Output output)
+{
+    if (name.empty() || name.find(OBJECT_PATH_SEPARATOR) != string::npos) {
+        output.perror() << "invalid " << kind << " name \"" << name << "\"\n";
+        return HERBST_INVALID_ARGUMENT;
+    }
+    return 0;
+}
+
+/**
+ * @brief take the remaining input as the command to be stored
+ * @return 0 or an error code if there is no command or if it does not exist
+ */
+int StoredCommand::readCommand(Input& input, Output output,
+                               shared_ptr<const ArgList::Container>& command)
+{
+    if (input.empty()) {
+        return HERBST_NEED_MORE_ARGS;
+    }
+    if (!Commands::commandExists(input.front())) {
+        output.perror() << "the command \""
+               << input.front() << "\" does not exist.\n";
+        return HERBST_COMMAND_NOT_FOUND;
+    }
+    command = make_shared<const ArgList::Container>(input.begin(), input.end());
+    return 0;
+}
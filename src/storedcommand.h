@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "attribute_.h"
+#include "commandio.h"
+#include "object.h"
+
+/**
+ * @brief An object holding a command (with its arguments) that was given
+ * by the user and that is called later, e.g. by a macro or a timer.
+ */
+class StoredCommand : public Object {
+public:
+    StoredCommand(std::shared_ptr<const ArgList::Container> command);
+    DynAttribute_<std::string> command_;
+
+    //! the input for calling the command. The command is not copied.
+    Input input() const { return Input(argv_); }
+
+    static int checkName(const std::string& name, const std::string& kind, Output output);
+    static int readCommand(Input& input, Output output,
+                           std::shared_ptr<const ArgList::Container>& command);
+protected:
+    //! the command and its arguments
+    std::shared_ptr<const ArgList::Container> argv_;
+private:
+    std::string getCommand();
+};
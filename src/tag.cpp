@@ -29,7 +29,7 @@ using std::shared_ptr;
 using std::string;
 using std::stringstream;
 
-static bool    g_tag_flags_dirty = true;
+static unsigned long g_tag_status_generation = 0;
 
 HSTag::HSTag(string name_, TagManager* tags, Settings* settings)
     : frame(*this, "tiling")
@@ -48,7 +48,6 @@ HSTag::HSTag(string name_, TagManager* tags, Settings* settings)
     , curframe_wcount(this, "curframe_wcount",
         [this] () { return frame->focusedFrame()->clientCount(); } )
     , focused_client(*this, "focused_client", &HSTag::focusedClient)
-    , flags(0)
     , floating_clients_focus_(0)
     , oldName_(name_)
     , tags_(tags)
@@ -624,15 +623,34 @@ int HSTag::computeFrameCount() {
     return count;
 }
 
-int HSTag::countUrgentClients()
+int HSTag::flags() const
 {
-    int count = 0;
-    foreachClient([&](Client* client) {
-        if (client->urgent_()) {
-            count++;
-        }
-    });
-    return count;
+    int result = 0;
+    if (clientCountTotal_ > 0) {
+        result |= TAG_FLAG_USED;
+    }
+    if (urgentClientCount_ > 0) {
+        result |= TAG_FLAG_URGENT;
+    }
+    return result;
+}
+
+/**
+ * @brief update the number of clients (and urgent clients) on this tag.
+ * This is called by the clients whenever they change their tag or
+ * their urgency.
+ */
+void HSTag::adjustClientCounts(int clientDelta, int urgentDelta)
+{
+    int oldFlags = flags();
+    clientCountTotal_ += clientDelta;
+    urgentClientCount_ += urgentDelta;
+    if (clientDelta != 0) {
+        clientListGeneration_++;
+    }
+    if (flags() != oldFlags) {
+        tag_status_changed();
+    }
 }
 
 int HSTag::computeClientCount() {
@@ -660,31 +678,22 @@ HSTag* get_tag_by_index(int index) {
     return &* global_tags->byIdx(index);
 }
 
-void tag_force_update_flags() {
-    g_tag_flags_dirty = false;
-    // unset all tags
-    for (auto t : *global_tags) {
-        t->flags = 0;
-    }
-    // update flags
-    for (auto c : Root::common().clients()) {
-        auto client = c.second;
-        TAG_SET_FLAG(client->tag(), TAG_FLAG_USED);
-        if (client->urgent_) {
-            TAG_SET_FLAG(client->tag(), TAG_FLAG_URGENT);
-        }
-    }
+void tag_set_flags_dirty() {
+    tag_status_changed();
+    hook_emit({"tag_flags"});
 }
 
-void tag_update_flags() {
-    if (g_tag_flags_dirty) {
-        tag_force_update_flags();
-    }
+//! mark the output of the tag_status command as outdated
+void tag_status_changed() {
+    g_tag_status_generation++;
 }
 
-void tag_set_flags_dirty() {
-    g_tag_flags_dirty = true;
-    hook_emit({"tag_flags"});
+/**
+ * @brief a number that changes whenever the tags, their names, their
+ * order or their flags change.
+ */
+unsigned long tag_status_generation() {
+    return g_tag_status_generation;
 }
 
 //! close the focused client or remove if the frame is empty
@@ -9,9 +9,6 @@
 #include "object.h"
 #include "signal.h"
 
-#define TAG_SET_FLAG(tag, flag) \
-    ((tag)->flags |= (flag))
-
 enum {
     TAG_FLAG_URGENT = 0x01, // is there a urgent window?
     TAG_FLAG_USED   = 0x02, // the opposite of empty
@@ -43,7 +40,11 @@ public:
     DynAttribute_<int> curframe_windex;
     DynAttribute_<int> curframe_wcount;
     DynChild_<Client> focused_client;
-    int             flags;
+    //! the combination of TAG_FLAG_USED and TAG_FLAG_URGENT
+    int flags() const;
+    void adjustClientCounts(int clientDelta, int urgentDelta);
+    //! a number that changes whenever a client enters or leaves this tag
+    unsigned long clientListGeneration() const { return clientListGeneration_; }
     std::vector<Client*> floating_clients_; //! the clients in floating mode
     // the tag must assert that the floating layer is only
     // focused if this tag hasVisibleFloatingClients()
@@ -93,8 +94,13 @@ private:
     int computeClientCount();
     //! get the number of clients on this tag
     int computeFrameCount();
-    //! get the number of urgent clients on this tag
-    int countUrgentClients();
+    //! the number of urgent clients on this tag
+    int countUrgentClients() { return urgentClientCount_; }
+    // the number of clients on this tag and how many of them are
+    // urgent, kept up to date by the clients via adjustClientCounts()
+    int clientCountTotal_ = 0;
+    int urgentClientCount_ = 0;
+    unsigned long clientListGeneration_ = 0;
     TagManager* tags_;
     Settings* settings_;
 };
@@ -103,9 +109,9 @@ private:
 HSTag* find_tag(const char* name);
 HSTag* get_tag_by_index(int index);
 int    tag_get_count();
-void tag_force_update_flags();
-void tag_update_flags();
 void tag_set_flags_dirty();
+void tag_status_changed();
+unsigned long tag_status_generation();
 
 #endif
 
@@ -229,6 +229,7 @@ void TagManager::tag_rename_command(CallOrComplete invoc) {
 }
 
 void TagManager::onTagRename(HSTag* tag) {
+    tag_status_changed();
     Ewmh::get().updateDesktopNames();
     hook_emit({"tag_renamed", tag->oldName_, tag->name()});
 }
@@ -408,12 +409,8 @@ function<void(Completion&)> TagManager::frameCompletion(FrameCompleter completer
 }
 
 HSTag* TagManager::newMonitorTag(TagSelectionStrategy strategy) {
-    if (strategy != TagSelectionStrategy::any_unshown) {
-        tag_update_flags();
-    }
-
     for (auto t : *this) {
-        if (!find_monitor_with_tag(&* t) && (strategy == TagSelectionStrategy::any_unshown || !(t->flags & TAG_FLAG_USED))) {
+        if (!find_monitor_with_tag(&* t) && (strategy == TagSelectionStrategy::any_unshown || !(t->flags() & TAG_FLAG_USED))) {
             return t;
         }
     }
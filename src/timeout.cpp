@@ -0,0 +1,74 @@
+#include "timeout.h"
+
+#include <algorithm>
+#include <vector>
+
+using std::function;
+using std::set;
+using std::vector;
+
+set<Timeout*> Timeout::s_registered;
+
+Timeout::Timeout(function<void()> callback)
+    : callback_(callback)
+{
+}
+
+Timeout::~Timeout()
+{
+    stop();
+}
+
+void Timeout::start(Clock::duration delay)
+{
+    startAt(Clock::now() + delay);
+}
+
+void Timeout::startAt(Clock::time_point deadline)
+{
+    deadline_ = deadline;
+    active_ = true;
+    s_registered.insert(this);
+}
+
+void Timeout::stop()
+{
+    active_ = false;
+    s_registered.erase(this);
+}
+
+Timeout::Clock::duration Timeout::nextDeadline()
+{
+    if (s_registered.empty()) {
+        return Clock::duration(-1);
+    }
+    auto earliest = (*std::min_element(s_registered.begin(), s_registered.end(),
+        [](const Timeout* a, const Timeout* b) {
+            return a->deadline_ < b->deadline_;
+        }))->deadline_;
+    return std::max(Clock::duration::zero(), earliest - Clock::now());
+}
+
+void Timeout::fireExpired()
+{
+    auto now = Clock::now();
+    vector<Timeout*> expired;
+    for (Timeout* t : s_registered) {
+        if (t->deadline_ <= now) {
+            expired.push_back(t);
+        }
+    }
+    std::sort(expired.begin(), expired.end(),
+        [](const Timeout* a, const Timeout* b) {
+            return a->deadline_ < b->deadline_;
+        });
+    for (Timeout* t : expired) {
+        // a callback may stop, restart or destroy other timeouts,
+        // so check that t is still due:
+        if (s_registered.count(t) == 0 || t->deadline_ > now) {
+            continue;
+        }
+        t->stop();
+        t->callback_();
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <set>
+
+/**
+ * A Timeout calls a callback function from the main loop once its
+ * deadline has passed. It does not fire on its own: the XMainLoop asks
+ * for the duration until the next deadline before it blocks in select()
+ * and fires all expired timeouts afterwards.
+ *
+ * A timeout is inactive initially and after it fired; it is
+ * unregistered automatically on destruction.
+ */
+class Timeout {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    Timeout(std::function<void()> callback);
+    ~Timeout();
+    Timeout(const Timeout&) = delete;
+    Timeout& operator=(const Timeout&) = delete;
+
+    //! (re)schedule the timeout to fire after the given delay
+    void start(Clock::duration delay);
+    //! (re)schedule the timeout to fire at the given time point
+    void startAt(Clock::time_point deadline);
+    void stop();
+    bool isActive() const { return active_; }
+    Clock::time_point deadline() const { return deadline_; }
+
+    /** the time until the next active timeout expires, or a negative
+     * duration if there is no active timeout at all
+     */
+    static Clock::duration nextDeadline();
+    //! fire all timeouts whose deadline has passed
+    static void fireExpired();
+private:
+    std::function<void()> callback_;
+    Clock::time_point deadline_;
+    bool active_ = false;
+
+    static std::set<Timeout*> s_registered;
+};
+
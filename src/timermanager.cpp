@@ -0,0 +1,294 @@
+#include "timermanager.h"
+
+#include <chrono>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+#include "argparse.h"
+#include "command.h"
+#include "completion.h"
+#include "ipc-protocol.h"
+#include "storedcommand.h"
+#include "timeout.h"
+#include "utils.h"
+
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+class Timer : public StoredCommand {
+public:
+    Timer(TimerManager& manager, int interval, bool once,
+          shared_ptr<const ArgList::Container> command)
+        : StoredCommand(command)
+        , interval_(this, "interval", interval)
+        , running_(this, "running", false)
+        , once_(this, "once", once)
+        , fireCount_(this, "fire_count", &Timer::getFireCount)
+        , manager_(manager)
+        , timeout_([this]() { manager_.timerElapsed(*this); })
+    {
+        setDoc("a timer created via the 'timer add' command");
+        interval_.setDoc("the time in milliseconds between two calls of the command");
+        running_.setDoc("whether the timer is running. If set to true, the "
+                        "command is called after the next interval.");
+        once_.setDoc("if set, the timer stops after it called the command once");
+        fireCount_.setDoc("the number of times the command was called");
+        interval_.setValidator([] (int newValue) {
+            if (newValue <= 0) {
+                return string("interval must be positive");
+            }
+            return string();
+        });
+        interval_.setWritable();
+        once_.setWritable();
+        running_.setWritable();
+        running_.changed().connect([this](bool running) {
+            if (running) {
+                schedule();
+            } else {
+                timeout_.stop();
+            }
+        });
+        interval_.changed().connect([this]() {
+            if (running_()) {
+                schedule();
+            }
+        });
+    }
+    Attribute_<int> interval_;
+    Attribute_<bool> running_;
+    Attribute_<bool> once_;
+    DynAttribute_<unsigned long> fireCount_;
+
+    //! (re)start the timer such that it elapses after the next interval
+    void start() {
+        if (running_()) {
+            schedule();
+        } else {
+            running_ = true;
+        }
+    }
+    void stop() {
+        running_ = false;
+    }
+
+    /**
+     * @brief Schedule the next call and return the input for the current
+     * one. The next deadline is computed from the previous deadline (and
+     * not from the current time) such that the calls do not drift. If the
+     * main loop was blocked for longer than an interval, the missed calls
+     * are skipped.
+     */
+    Input elapse() {
+        fireCount++;
+        if (once_()) {
+            running_ = false;
+        } else {
+            auto interval = std::chrono::milliseconds(interval_());
+            auto now = Timeout::Clock::now();
+            nextDeadline_ += interval;
+            if (nextDeadline_ <= now) {
+                nextDeadline_ += ((now - nextDeadline_) / interval + 1) * interval;
+            }
+            timeout_.startAt(nextDeadline_);
+        }
+        return input();
+    }
+private:
+    void schedule() {
+        nextDeadline_ = Timeout::Clock::now() + std::chrono::milliseconds(interval_());
+        timeout_.startAt(nextDeadline_);
+    }
+    unsigned long getFireCount() { return fireCount; }
+
+    TimerManager& manager_;
+    Timeout timeout_;
+    Timeout::Clock::time_point nextDeadline_;
+    unsigned long fireCount = 0;
+};
+
+TimerManager::TimerManager()
+    : count_(this, "count", &TimerManager::count)
+{
+    setDoc("For every timer, there is an entry with its name.");
+    count_.setDoc("the number of timers");
+}
+
+TimerManager::~TimerManager()
+{
+    for (auto& it : timers_) {
+        removeChild(it.first);
+    }
+}
+
+template<>
+Finite<TimerManager::Subcommand>::ValueList Finite<TimerManager::Subcommand>::values = ValueListPlain {
+    { TimerManager::Subcommand::Add, "add" },
+    { TimerManager::Subcommand::Remove, "remove" },
+    { TimerManager::Subcommand::Start, "start" },
+    { TimerManager::Subcommand::Stop, "stop" },
+};
+
+int TimerManager::timerCommand(Input input, Output output)
+{
+    Subcommand subcommand = Subcommand::Add;
+    ArgParse ap = ArgParse().mandatory(subcommand);
+    if (ap.parsingFails(input, output)) {
+        return ap.exitCode();
+    }
+    switch (subcommand) {
+        case Subcommand::Add: return addTimer(input, output);
+        case Subcommand::Remove: return removeTimer(input, output);
+        case Subcommand::Start: return startTimer(input, output);
+        case Subcommand::Stop: return stopTimer(input, output);
+    }
+    return HERBST_INVALID_ARGUMENT;
+}
+
+//! timer add NAME INTERVAL [--once] COMMAND [ARGS ...]
+int TimerManager::addTimer(Input input, Output output)
+{
+    string name;
+    int interval = 0;
+    bool once = false;
+    ArgParse ap = ArgParse().mandatory(name).mandatory(interval);
+    ap.flags({{"--once", &once}});
+    if (ap.parsingFails(input, output)) {
+        return ap.exitCode();
+    }
+    int status = StoredCommand::checkName(name, "timer", output);
+    if (status != 0) {
+        return status;
+    }
+    if (interval <= 0) {
+        output.perror() << "interval must be positive\n";
+        return HERBST_INVALID_ARGUMENT;
+    }
+    shared_ptr<const ArgList::Container> command;
+    status = StoredCommand::readCommand(input, output, command);
+    if (status != 0) {
+        return status;
+    }
+    if (timers_.find(name) != timers_.end()) {
+        output.perror() << "a timer named \"" << name << "\" already exists\n";
+        return HERBST_INVALID_ARGUMENT;
+    }
+    auto& timer = timers_[name];
+    timer = make_unique<Timer>(*this, interval, once, command);
+    addChild(timer.get(), name);
+    timer->start();
+    return 0;
+}
+
+//! look up the timer of the given name
+Timer* TimerManager::findTimer(const string& name, Output output)
+{
+    auto it = timers_.find(name);
+    if (it == timers_.end()) {
+        output.perror() << "no such timer: " << name << "\n";
+        return nullptr;
+    }
+    return it->second.get();
+}
+
+//! timer remove NAME
+int TimerManager::removeTimer(Input input, Output output)
+{
+    string name;
+    ArgParse ap = ArgParse().mandatory(name);
+    if (ap.parsingAllFails(input, output)) {
+        return ap.exitCode();
+    }
+    auto it = timers_.find(name);
+    if (it == timers_.end()) {
+        output.perror() << "no such timer: " << name << "\n";
+        return HERBST_INVALID_ARGUMENT;
+    }
+    removeChild(name);
+    it->second->stop();
+    if (it->second.get() == elapsedTimer_) {
+        // the timer removes itself. We are still in its callback,
+        // so defer its destruction
+        removedTimer_ = std::move(it->second);
+    }
+    timers_.erase(it);
+    return 0;
+}
+
+//! timer start NAME
+int TimerManager::startTimer(Input input, Output output)
+{
+    string name;
+    ArgParse ap = ArgParse().mandatory(name);
+    if (ap.parsingAllFails(input, output)) {
+        return ap.exitCode();
+    }
+    Timer* timer = findTimer(name, output);
+    if (!timer) {
+        return HERBST_INVALID_ARGUMENT;
+    }
+    timer->start();
+    return 0;
+}
+
+//! timer stop NAME
+int TimerManager::stopTimer(Input input, Output output)
+{
+    string name;
+    ArgParse ap = ArgParse().mandatory(name);
+    if (ap.parsingAllFails(input, output)) {
+        return ap.exitCode();
+    }
+    Timer* timer = findTimer(name, output);
+    if (!timer) {
+        return HERBST_INVALID_ARGUMENT;
+    }
+    timer->stop();
+    return 0;
+}
+
+void TimerManager::timerElapsed(Timer& timer)
+{
+    // a timer that removed itself earlier is not running anymore
+    removedTimer_.reset();
+    Input input = timer.elapse();
+    // discard output, but forward errors to std::cerr
+    std::ostream discardedOutput(nullptr);
+    OutputChannels channels(input.command(), discardedOutput, std::cerr);
+    elapsedTimer_ = &timer;
+    Commands::call(input, channels);
+    elapsedTimer_ = nullptr;
+}
+
+void TimerManager::timerCompletion(Completion& complete)
+{
+    if (complete == 0) {
+        Converter<Subcommand>::complete(complete);
+        return;
+    }
+    const string& subcommand = complete[0];
+    if (subcommand == "add") {
+        // the name and the interval can be anything
+        if (complete == 3) {
+            complete.full("--once");
+            complete.completeCommands(3);
+        } else if (complete > 3) {
+            complete.completeCommands(complete[3] == "--once" ? 4 : 3);
+        }
+    } else if (subcommand == "remove"
+               || subcommand == "start"
+               || subcommand == "stop")
+    {
+        if (complete == 1) {
+            for (const auto& it : timers_) {
+                complete.full(it.first);
+            }
+        } else {
+            complete.none();
+        }
+    } else {
+        complete.none();
+    }
+}
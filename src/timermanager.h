@@ -0,0 +1,54 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "attribute_.h"
+#include "commandio.h"
+#include "finite.h"
+#include "object.h"
+
+class Completion;
+class Timer;
+
+/**
+ * @brief The TimerManager holds the timers that call commands
+ * periodically (or once) from the main loop.
+ */
+class TimerManager : public Object {
+public:
+    enum class Subcommand {
+        Add,
+        Remove,
+        Start,
+        Stop,
+    };
+    TimerManager();
+    ~TimerManager() override;
+    DynAttribute_<unsigned long> count_;
+
+    int timerCommand(Input input, Output output);
+    void timerCompletion(Completion& complete);
+    //! called by a timer whenever its interval has elapsed
+    void timerElapsed(Timer& timer);
+private:
+    int addTimer(Input input, Output output);
+    int removeTimer(Input input, Output output);
+    int startTimer(Input input, Output output);
+    int stopTimer(Input input, Output output);
+    Timer* findTimer(const std::string& name, Output output);
+    unsigned long count() const { return timers_.size(); }
+
+    std::map<std::string, std::unique_ptr<Timer>> timers_;
+    //! the timer whose command is currently running
+    Timer* elapsedTimer_ = nullptr;
+    /** a timer that was removed by its own command. It is only destroyed
+     * once its command has returned.
+     */
+    std::unique_ptr<Timer> removedTimer_;
+};
+
+template <>
+struct is_finite<TimerManager::Subcommand> : std::true_type {};
+template<> Finite<TimerManager::Subcommand>::ValueList Finite<TimerManager::Subcommand>::values;
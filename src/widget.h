@@ -10,7 +10,7 @@
 class BoxStyle;
 class TreeInterface;
 class WidgetTI;
-class X11WidgetRender;
+class WidgetRender;
 
 /**
  * @brief A widget can either have text content
@@ -66,7 +66,7 @@ public:
 
     std::shared_ptr<TreeInterface> treeInterface();
 private:
-    friend class X11WidgetRender;
+    friend class WidgetRender;
     friend class WidgetTI;
     CssNameSet classes_ = {};
     Widget* parent_ = nullptr;
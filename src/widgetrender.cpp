@@ -0,0 +1,200 @@
+#include "widgetrender.h"
+
+#include <vector>
+
+#include "css.h"
+#include "fontdata.h"
+#include "settings.h"
+#include "utils.h"
+#include "widget.h"
+
+enum {
+    TopBorder = 0,
+    RightBorder = 1,
+    BottomBorder = 2,
+    LeftBorder = 3,
+};
+
+using std::pair;
+using std::string;
+using std::vector;
+
+WidgetRender::WidgetRender(Settings& settings, Point2D targetPos)
+    : settings_(settings)
+    , targetPos_(targetPos)
+{
+}
+
+void WidgetRender::render(const Widget& widget)
+{
+    const BoxStyle& style = widget.style_
+            ? *widget.style_
+            : BoxStyle::empty();
+    if (style.display == CssDisplay::none) {
+        return;
+    }
+    Rectangle geo =
+            widget
+            .geometryCached()
+            .shifted(targetPos_ * -1)
+            .adjusted(-style.marginLeft,
+                      -style.marginTop,
+                      -style.marginRight,
+                      -style.marginBottom);
+    style.backgroundColor.ifRight([&](const Color& bgcol) {
+        fillRectangle(geo, bgcol);
+    });
+
+    Rectangle outline = geo.adjusted(style.outlineWidthLeft, style.outlineWidthTop,
+                                     style.outlineWidthRight, style.outlineWidthBottom);
+    int outlineWidth[4] = {
+        style.outlineWidthTop,
+        style.outlineWidthRight,
+        style.outlineWidthBottom,
+        style.outlineWidthLeft,
+    };
+    Color outlineColor[4] = {
+        style.outlineColorTop,
+        style.outlineColorRight,
+        style.outlineColorBottom,
+        style.outlineColorLeft,
+    };
+    drawBorder(outline, outlineWidth, outlineColor);
+
+    int borderWidth[4] = {
+        style.borderWidthTop,
+        style.borderWidthRight,
+        style.borderWidthBottom,
+        style.borderWidthLeft,
+    };
+    Color borderColor[4] = {
+        style.borderColorTop,
+        style.borderColorRight,
+        style.borderColorBottom,
+        style.borderColorLeft,
+    };
+    drawBorder(geo, borderWidth, borderColor);
+
+    for (const Widget* child : widget.nestedWidgets_) {
+        render(*child);
+    }
+    if (widget.textContent_) {
+        Rectangle contentGeo = widget.contentGeometryCached();
+        Point2D textPos = contentGeo.tl();
+        HSFont font = style.getFont();
+        int textHeight = style.textHeight.rightOr(font.data().ascent);
+        int textDepth = style.textDepth.rightOr(font.data().descent);
+        int extraSpace = contentGeo.height - textHeight - textDepth;
+        textPos.y += extraSpace / 2 + textHeight;
+        if (textHeight != 0) {
+            drawText(font.data(), style.fontColor,
+                     textPos - targetPos_, widget.textContent_(), contentGeo.width, style.textAlign);
+        }
+    }
+}
+
+void WidgetRender::drawBorder(Rectangle outer, int width[4], Color color[4])
+{
+    Rectangle inner = outer.adjusted(-width[LeftBorder],
+                                     -width[TopBorder],
+                                     -width[RightBorder],
+                                     -width[BottomBorder]);
+    // first draw the rectangular subset of the borders:
+    vector<pair<const Color*,Rectangle>> borderRects = {
+        {color + TopBorder,
+         {inner.x, outer.y, inner.width, width[TopBorder]}},
+        {color + RightBorder,
+         {inner.x + inner.width, inner.y, width[RightBorder], inner.height}},
+        {color + BottomBorder,
+         {inner.x, inner.y + inner.height, inner.width, width[BottomBorder]}},
+        {color + LeftBorder,
+         {outer.x, inner.y, width[LeftBorder], inner.height}},
+    };
+    for (const auto& p : borderRects) {
+        if (p.second) {
+            fillRectangle(p.second, *(p.first));
+        }
+    }
+    // top left corner
+    Rectangle tlcorn = {
+        outer.x, outer.y, width[LeftBorder], width[TopBorder]
+    };
+    fillTriangle(tlcorn.tl(), tlcorn.bl(), tlcorn.br(), color[LeftBorder]);
+    fillTriangle(tlcorn.tl(), tlcorn.tr(), tlcorn.br(), color[TopBorder]);
+    // top right corner
+    Rectangle trcorn = {
+        inner.x + inner.width,
+        outer.y, width[RightBorder], width[TopBorder]
+    };
+    fillTriangle(trcorn.tl(), trcorn.tr(), trcorn.bl(), color[TopBorder]);
+    fillTriangle(trcorn.tr(), trcorn.br(), trcorn.bl(), color[RightBorder]);
+    // bottom right corner
+    Rectangle brcorn = {
+        inner.x + inner.width,
+        inner.y + inner.height,
+        width[RightBorder], width[BottomBorder]
+    };
+    fillTriangle(brcorn.tl(), brcorn.tr(), brcorn.br(), color[RightBorder]);
+    fillTriangle(brcorn.br(), brcorn.bl(), brcorn.tl(), color[BottomBorder]);
+    // bottom left corner
+    Rectangle blcorn = {
+        outer.x, inner.y + inner.height,
+        width[LeftBorder], width[BottomBorder]
+    };
+    fillTriangle(blcorn.tr(), blcorn.br(), blcorn.bl(), color[BottomBorder]);
+    fillTriangle(blcorn.tl(), blcorn.tr(), blcorn.bl(), color[LeftBorder]);
+}
+
+/**
+ * @brief Draw a given text, shortened with the ellipsis if necessary
+ * @param fontData
+ * @param color
+ * @param position The position of the left end of the baseline
+ * @param text
+ * @param width The maximum width of the string (in pixels)
+ * @param the horizontal alignment within this maximum width
+ */
+void WidgetRender::drawText(const FontData& fontData, const Color& color,
+                            Point2D position, const string& text, int width,
+                            const TextAlign& align)
+{
+    // shorten the text first:
+    size_t textLen = text.size();
+    int textwidth = fontData.textwidth(text, textLen);
+    string with_ellipsis; // declaration here for sufficently long lifetime
+    const string* finalText = nullptr;
+    if (textwidth <= width) {
+        finalText = &text;
+    } else {
+        // shorten title:
+        with_ellipsis = text + settings_.ellipsis();
+        // temporarily, textLen is the length of the text surviving from the
+        // original window title
+        while (textLen > 0 && textwidth > width) {
+            textLen--;
+            // remove the (multibyte-)character that ends at with_ellipsis[textLen]
+            size_t character_width = 1;
+            while (textLen > 0 && utf8_is_continuation_byte(with_ellipsis[textLen])) {
+                textLen--;
+                character_width++;
+            }
+            // now, textLen points to the first byte of the (multibyte-)character
+            with_ellipsis.erase(textLen, character_width);
+            textwidth = fontData.textwidth(with_ellipsis, with_ellipsis.size());
+        }
+        // make textLen refer to the actual string and shorten further if it
+        // is still too wide:
+        textLen = with_ellipsis.size();
+        while (textLen > 0 && textwidth > width) {
+            textLen--;
+            textwidth = fontData.textwidth(with_ellipsis, textLen);
+        }
+        finalText = &with_ellipsis;
+    }
+    switch (align) {
+    case TextAlign::left: break;
+    case TextAlign::center: position.x += (width - textwidth) / 2; break;
+    case TextAlign::right: position.x += width - textwidth; break;
+    }
+    drawString(fontData, color, position, *finalText, textLen);
+}
@@ -0,0 +1,48 @@
+#ifndef WIDGETRENDER_H
+#define WIDGETRENDER_H
+
+#include <string>
+
+#include "rectangle.h"
+#include "x11-types.h"
+
+class Widget;
+class FontData;
+class Settings;
+enum class TextAlign;
+
+/**
+ * @brief The backend independent part of rendering a widget tree:
+ * it traverses the widgets, computes the border shapes, shortens and
+ * aligns text, and delegates the actual drawing to the primitives
+ * of a concrete backend (e.g. X11WidgetRender or ImageWidgetRender).
+ */
+class WidgetRender
+{
+public:
+    WidgetRender(Settings& settings, Point2D targetPos);
+    virtual ~WidgetRender() = default;
+    void render(const Widget& widget);
+protected:
+    /** the drawing primitives. All coordinates are relative
+     * to the top left corner of the render target.
+     */
+    virtual void fillRectangle(Rectangle rect, const Color& color) = 0;
+    virtual void fillTriangle(Point2D p1, Point2D p2, Point2D p3, const Color& color) = 0;
+    /** draw the first 'len' bytes of 'text' such that the left end of
+     * the baseline is at 'position'
+     */
+    virtual void drawString(const FontData& fontData, const Color& color,
+                            Point2D position, const std::string& text, size_t len) = 0;
+
+    Settings& settings_;
+private:
+    void drawBorder(Rectangle outer, int width[4], Color color[4]);
+    void drawText(const FontData& fontData, const Color& color,
+                  Point2D position, const std::string& text,
+                  int width, const TextAlign& align);
+
+    Point2D targetPos_; //! the position of the render target
+};
+
+#endif // WIDGETRENDER_H
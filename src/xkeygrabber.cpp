@@ -69,70 +69,109 @@ KeyCombo XKeyGrabber::xEventToKeyCombo(XKeyEvent* ev) {
     return combo;
 }
 
-//! Grabs the given key combo
+/*!
+ * Marks the given key combo to be grabbed. The grab becomes
+ * effective with the next call to applyGrabs()
+ */
 void XKeyGrabber::grabKeyCombo(KeyCombo keyCombo) {
     auto x11KeyCombo = keyCombo;
     x11KeyCombo.onRelease_ = false;
-    int oldCount = keyComboCount(x11KeyCombo);
-    setKeyComboCount(x11KeyCombo, oldCount + 1);
-    if (oldCount <= 0) {
-        changeGrabbedState(x11KeyCombo, true);
-    }
+    setKeyComboCount(x11KeyCombo, keyComboCount(x11KeyCombo) + 1);
 }
 
-//! Ungrabs the given key combo
+/*!
+ * Marks the given key combo to be ungrabbed. The grab is released
+ * with the next call to applyGrabs()
+ */
 void XKeyGrabber::ungrabKeyCombo(KeyCombo keyCombo) {
     auto x11KeyCombo = keyCombo;
     x11KeyCombo.onRelease_ = false;
-    int oldCount = keyComboCount(x11KeyCombo);
-    setKeyComboCount(x11KeyCombo, oldCount - 1);
-    if (oldCount > 0 && oldCount - 1 <= 0) {
-        changeGrabbedState(x11KeyCombo, false);
-    }
+    setKeyComboCount(x11KeyCombo, keyComboCount(x11KeyCombo) - 1);
 }
 
 //! Removes all grabbed keys (without knowing them)
 void XKeyGrabber::ungrabAll() {
     XUngrabKey(X_.display(), AnyKey, AnyModifier, X_.root());
+    XFlush(X_.display());
     keycombo2bindCount_.clear();
+    activeGrabs_.clear();
+    grabsOutdated_ = false;
 }
 
-void XKeyGrabber::regrabAll()
+/*!
+ * Bring the grabs on the X server in sync with the grabbed key combos.
+ * Only the difference between the currently active grabs and the
+ * required grabs is sent to the X server, followed by a single flush.
+ */
+void XKeyGrabber::applyGrabs()
 {
-    updateNumlockMask();
-
-     // Remove all current grabs:
-    XUngrabKey(X_.display(), AnyKey, AnyModifier, X_.root());
-
-    // grab precisely those again, that have been grabbed before.
-    // here, it is important that we grab each KeyCombo only once.
-    // this works, because even if both press&release are grabbed, the
-    // map has only one combined entry for both.
-    for (auto& binding : keycombo2bindCount_) {
-        changeGrabbedState(binding.first, true);
+    if (!grabsOutdated_) {
+        return;
+    }
+    grabsOutdated_ = false;
+    std::set<X11Grab> required = requiredGrabs();
+    bool changed = false;
+    for (const auto& grab : activeGrabs_) {
+        if (required.find(grab) == required.end()) {
+            XUngrabKey(X_.display(), grab.first, grab.second, X_.root());
+            changed = true;
+        }
+    }
+    for (const auto& grab : required) {
+        if (activeGrabs_.find(grab) == activeGrabs_.end()) {
+            XGrabKey(X_.display(), grab.first, grab.second, X_.root(),
+                    True, GrabModeAsync, GrabModeAsync);
+            changed = true;
+        }
+    }
+    activeGrabs_ = std::move(required);
+    if (changed) {
+        XFlush(X_.display());
     }
 }
 
-//! Grabs/ungrabs a given key combo
-void XKeyGrabber::changeGrabbedState(const KeyCombo& keyCombo, bool grabbed) {
-    // List of ignored modifiers (key combo will be grabbed for each of them):
-    const unsigned int ignModifiers[] = { 0, LockMask, numlockMask_, numlockMask_ | LockMask };
+//! Grabs the entire keyboard, e.g. while a key chord is entered
+void XKeyGrabber::grabKeyboard()
+{
+    XGrabKeyboard(X_.display(), X_.root(), True,
+                  GrabModeAsync, GrabModeAsync, CurrentTime);
+}
 
-    KeyCode keycode = XKeysymToKeycode(X_.display(), keyCombo.keysym);
-    if (!keycode) {
-        // Ignore unknown keysym
-        return;
-    }
+void XKeyGrabber::ungrabKeyboard()
+{
+    XUngrabKeyboard(X_.display(), CurrentTime);
+}
 
-    // Grab/ungrab key for each modifier that is ignored (capslock, numlock)
-    for (auto& ignModifier : ignModifiers) {
-        if (grabbed) {
-            XGrabKey(X_.display(), keycode, ignModifier | keyCombo.modifiers_, X_.root(),
-                    True, GrabModeAsync, GrabModeAsync);
-        } else {
-            XUngrabKey(X_.display(), keycode, ignModifier | keyCombo.modifiers_, X_.root());
+void XKeyGrabber::regrabAll()
+{
+    // the key codes and the numlock mask might have changed, so
+    // the required grabs have to be computed from scratch:
+    updateNumlockMask();
+    grabsOutdated_ = true;
+    applyGrabs();
+}
+
+/*!
+ * Compute the grabs required for the grabbed key combos with respect
+ * to the current keyboard mapping. Each key combo is grabbed once for every
+ * combination of the ignored modifiers (capslock, numlock).
+ */
+std::set<XKeyGrabber::X11Grab> XKeyGrabber::requiredGrabs() const {
+    const unsigned int ignModifiers[] = { 0, LockMask, numlockMask_, numlockMask_ | LockMask };
+    std::set<X11Grab> grabs;
+    // even if both press&release of a KeyCombo are bound, the
+    // map has only one combined entry for both.
+    for (const auto& binding : keycombo2bindCount_) {
+        KeyCode keycode = XKeysymToKeycode(X_.display(), binding.first.keysym);
+        if (!keycode) {
+            // Ignore unknown keysym
+            continue;
+        }
+        for (auto& ignModifier : ignModifiers) {
+            grabs.insert({keycode, ignModifier | binding.first.modifiers_});
         }
     }
+    return grabs;
 }
 
 int XKeyGrabber::keyComboCount(const KeyCombo& x11KeyCombo)
@@ -146,6 +185,9 @@ int XKeyGrabber::keyComboCount(const KeyCombo& x11KeyCombo)
 
 void XKeyGrabber::setKeyComboCount(const KeyCombo& x11KeyCombo, int newCount)
 {
+    if ((keyComboCount(x11KeyCombo) > 0) != (newCount > 0)) {
+        grabsOutdated_ = true;
+    }
     if (newCount <= 0) {
         keycombo2bindCount_.erase(x11KeyCombo);
     } else {
@@ -2,7 +2,9 @@
 
 #include <X11/Xlib.h>
 #include <map>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "keycombo.h"
@@ -27,6 +29,9 @@ public:
     void grabKeyCombo(KeyCombo keyCombo);
     void ungrabKeyCombo(KeyCombo keyCombo);
     void ungrabAll();
+    void applyGrabs();
+    void grabKeyboard();
+    void ungrabKeyboard();
 
     void regrabAll();
 
@@ -39,13 +44,20 @@ public:
     static std::vector<std::string> getPossibleKeySyms();
 
 private:
-    void changeGrabbedState(const KeyCombo& keyCombo, bool grabbed);
+    //! a passive grab on the root window: a key code and a modifier mask
+    using X11Grab = std::pair<KeyCode, unsigned int>;
+    std::set<X11Grab> requiredGrabs() const;
     unsigned int numlockMask_ = 0;
     // for each (X11-)keycombo, we count in how many keybinds it is used.
     // it might be used in multiple because there are binds for both key press
     // and key release. The map only contains KeyCombo objects with
     // onRelease_ = false.
     std::map<KeyCombo,int> keycombo2bindCount_;
+    // the grabs that are currently active on the X server
+    std::set<X11Grab> activeGrabs_;
+    // whether keycombo2bindCount_ possibly requires different grabs than
+    // the ones in activeGrabs_
+    bool grabsOutdated_ = false;
     // for each key code, whenever we see a key down event, remember
     // the modifier mask, such that we can re-use it for the key up event.
     std::map<unsigned int, unsigned int> keycode2modifierMask_;
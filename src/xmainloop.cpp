@@ -4,7 +4,9 @@
 #include <X11/Xatom.h>
 #include <X11/Xlib.h>
 #include <X11/cursorfont.h>
+#include <sys/select.h>
 #include <sys/wait.h>
+#include <chrono>
 #include <iostream>
 #include <memory>
 
@@ -16,6 +18,7 @@
 #include "ewmh.h"
 #include "framedecoration.h"
 #include "frametree.h"
+#include "freezer.h"
 #include "hlwmcommon.h"
 #include "ipc-server.h"
 #include "keymanager.h"
@@ -29,6 +32,7 @@
 #include "settings.h"
 #include "tag.h"
 #include "tagmanager.h"
+#include "timeout.h"
 #include "utils.h"
 #include "watchers.h"
 #include "xconnection.h"
@@ -131,6 +135,9 @@ void XMainLoop::scanExistingClients() {
                 }
             };
     };
+    // manage all windows first and only then update the layout,
+    // the stacking and the ewmh client list once
+    clientmanager->beginBulkImport();
     for (auto win : X_.queryTree(X_.root())) {
         if (!XGetWindowAttributes(X_.display(), win, &wa) || wa.override_redirect)
         {
@@ -144,13 +151,14 @@ void XMainLoop::scanExistingClients() {
         if (root_->ewmh_.isOwnWindow(win)) {
             continue;
         }
-        if (root_->ewmh_.getWindowType(win) == NetWmWindowTypeDesktop)
+        int windowType = root_->ewmh_.getWindowType(win);
+        if (windowType == NetWmWindowTypeDesktop)
         {
+            // the final restack below also covers the desktop windows
             DesktopWindow::registerDesktop(win);
-            root_->monitors->restack();
             XMapWindow(X_.display(), win);
         }
-        else if (root_->ewmh_.getWindowType(win) == NetWmWindowTypeDock)
+        else if (windowType == NetWmWindowTypeDock)
         {
             root_->panels->registerPanel(win);
             XSelectInput(X_.display(), win, PropertyChangeMask);
@@ -177,6 +185,7 @@ void XMainLoop::scanExistingClients() {
         XReparentWindow(X_.display(), win, X_.root(), 0,0);
         clientmanager->manage_client(win, true, false, findTagForWindow(win));
     }
+    clientmanager->endBulkImport();
     root_->monitors->restack();
 }
 
@@ -193,13 +202,24 @@ void XMainLoop::run() {
         // set the the `select` sets:
         FD_ZERO(&in_fds);
         FD_SET(x11_fd, &in_fds);
-        // wait for an event or a signal
-        select(x11_fd + 1, &in_fds, nullptr, nullptr, nullptr);
+        // wait for an event, a signal, or the next timeout
+        struct timeval timeout = {};
+        struct timeval* timeoutPtr = nullptr;
+        auto untilNextTimeout = Timeout::nextDeadline();
+        if (untilNextTimeout >= Timeout::Clock::duration::zero()) {
+            auto usec = std::chrono::duration_cast<std::chrono::microseconds>(untilNextTimeout).count();
+            timeout.tv_sec = usec / 1000000;
+            timeout.tv_usec = usec % 1000000;
+            timeoutPtr = &timeout;
+        }
+        select(x11_fd + 1, &in_fds, nullptr, nullptr, timeoutPtr);
         // if `select` was interrupted by a signal, then it was maybe SIGCHLD
         collectZombies();
         if (aboutToQuit_) {
             break;
         }
+        Timeout::fireExpired();
+        root_->watchers->scanForChanges();
         XSync(X_.display(), False);
         while (XQLength(X_.display())) {
             XNextEvent(X_.display(), &event);
@@ -311,6 +331,8 @@ void XMainLoop::buttonpress(XButtonEvent* be) {
 
 void XMainLoop::buttonrelease(XButtonEvent*) {
     HSDebug("name is: ButtonRelease\n");
+    // the final cursor position is always applied
+    root_->mouse->flushPendingMotion();
     root_->mouse->mouse_stop_drag();
 }
 
@@ -438,6 +460,7 @@ void XMainLoop::destroynotify(XUnmapEvent* event) {
     } else {
         DesktopWindow::unregisterDesktop(event->window);
         root_->panels->unregisterPanel(event->window);
+        root_->freeze->ipcConnectionClosed(event->window);
     }
 }
 
@@ -683,7 +706,7 @@ void XMainLoop::propertynotify(XPropertyEvent* ev) {
                 }
             } else if (ev->atom == XA_WM_NAME ||
                        ev->atom == root_->ewmh_.netatom(NetWmName)) {
-                client->update_title();
+                client->titlePropertyChanged();
             } else if (ev->atom == XA_WM_CLASS && client) {
                 // according to the ICCCM specification, the WM_CLASS property may only
                 // be changed in the withdrawn state:
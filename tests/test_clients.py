@@ -1,5 +1,6 @@
 import pytest
 import random
+import time
 from conftest import PROCESS_SHUTDOWN_TIME
 from herbstluftwm.types import Rectangle
 
@@ -729,3 +730,25 @@ def test_sticky_swap_tags(hlwm):
 
     hlwm.call(f"focus_monitor {monitor2}")
     assert hlwm.attr.tags.focus.focused_client.winid() == client2
+
+
+def test_title_refresh_rate_delivers_final_title(hlwm, x11):
+    hlwm.attr.settings.title_refresh_rate = 2
+    handle, winid = x11.create_client()
+    # wait until the title update during manage is longer ago than 1/2 second
+    time.sleep(0.6)
+
+    for i in range(0, 10):
+        x11.set_window_title(handle, f'title {i}')
+
+    # only the first change is applied immediately
+    assert hlwm.attr.clients[winid].title() == 'title 0'
+    time.sleep(0.6)
+    # the remaining changes are coalesced and the last title is applied
+    x11.sync_with_hlwm()
+    assert hlwm.attr.clients[winid].title() == 'title 9'
+
+
+def test_title_refresh_rate_not_negative(hlwm):
+    hlwm.call_xfail('set title_refresh_rate -1') \
+        .expect_stderr('must not be negative')
@@ -26,6 +26,40 @@ def test_window_border_plain(hlwm, x11):
     assert img.color_count(color) == expected_count
 
 
+def render_client_histogram(hlwm, winid):
+    """render the decoration of the given client with the offscreen
+    image backend and return its size and color counts"""
+    lines = hlwm.call(['debug_css', '--render-client=' + winid]).stdout.splitlines()
+    width, height = [int(v) for v in lines[0].split(' ')]
+    color_count = {}
+    for line in lines[1:]:
+        color, count = line.split(' ')
+        color_count[color] = int(count)
+    return width, height, color_count
+
+
+def test_render_client_offscreen_like_x11(hlwm, x11):
+    color = (0x9f, 0xbc, 0x12)
+    inner_color = (48, 225, 26)
+    bw = 5  # border width
+    handle, winid = x11.create_client()
+    hlwm.attr.theme.color = RawImage.rgb2string(color)
+    hlwm.attr.theme.border_width = bw
+    hlwm.attr.theme.inner_color = RawImage.rgb2string(inner_color)
+    hlwm.attr.theme.inner_width = 2
+    img = x11.decoration_screenshot(handle)
+
+    width, height, color_count = render_client_histogram(hlwm, winid)
+
+    assert (width, height) == (img.width, img.height)
+    for rgb in [color, inner_color]:
+        assert color_count[RawImage.rgb2string(rgb)] == img.color_count(rgb)
+    # the border pixels are exactly the outer ring of the image
+    expected_count = 2 * bw * width + 2 * bw * height - 4 * bw * bw
+    assert color_count[RawImage.rgb2string(color)] \
+        + color_count[RawImage.rgb2string(inner_color)] == expected_count
+
+
 @pytest.mark.parametrize("xvfb", [{'xrender': v} for v in [True, False]], indirect=True)
 @pytest.mark.parametrize("hlwm_process", [{'transparency': v} for v in [True, False]], indirect=True)
 def test_window_border_inner(hlwm, x11):
@@ -396,6 +430,26 @@ def test_decoration_tab_title_update(hlwm, x11):
     assert x11.decoration_screenshot(win_handles[0]).color_count(text_color) > 5
 
 
+def test_decoration_covered_tab_bar_updated_when_visible(hlwm, x11):
+    text_color = (212, 189, 140)
+    hlwm.attr.theme.title_color = RawImage.rgb2string(text_color)
+    hlwm.attr.theme.title_height = 20
+    hlwm.call(['set_layout', 'max'])
+    hlwm.call(['split', 'bottom'])
+    hlwm.call(['split', 'bottom'])
+
+    win_handles = [x11.create_client()[0] for _ in range(0, 3)]
+    for wh in win_handles:
+        x11.set_window_title(wh, '')
+    hlwm.call(['jumpto', x11.winid_str(win_handles[0])])
+
+    # change a title while the tab bar of handle 1 is covered:
+    x11.set_window_title(win_handles[2], 'SOMETHING')
+    # the change is visible in the tab bar of handle 1 once it is focused
+    hlwm.call(['jumpto', x11.winid_str(win_handles[1])])
+    assert x11.decoration_screenshot(win_handles[1]).color_count(text_color) > 5
+
+
 @pytest.mark.parametrize("running_clients_num", [4])
 def test_decoration_click_changes_tab(hlwm, mouse, running_clients, running_clients_num):
     hlwm.call(['load', '(clients max:0 {})'.format(' '.join(running_clients))])
@@ -56,24 +56,46 @@ def create_panel(hlwm):
     return f'panels.{winid}'
 
 
+def create_rule(hlwm):
+    hlwm.call('rule class=foo tag=bar')
+    return 'rules.0'
+
+
+def create_macro(hlwm):
+    hlwm.call('macro define foo X -- echo X')
+    return 'macros.foo'
+
+
+def create_timer(hlwm):
+    hlwm.call('timer add foo 100000 true')
+    return 'timers.foo'
+
+
 # map every c++ class name to a function ("constructor") accepting an hlwm
 # fixture and returning the path to an example object of the C++ class
 classname2examplepath = [
     ('ByName', lambda _: 'monitors.by-name'),
+    ('ChangeJournal', lambda _: 'journal'),
     ('Client', create_client),
     ('ClientManager', create_clients_with_all_links),
     ('DecTriple', lambda _: 'theme.tiling'),
     ('DecorationScheme', lambda _: 'theme.tiling.urgent'),
     ('FrameLeaf', lambda _: 'tags.0.tiling.root'),
     ('FrameSplit', create_frame_split),
+    ('Freezer', lambda _: 'freeze'),
     ('HSTag', create_tag_with_all_links),
+    ('Macro', create_macro),
+    ('MacroManager', lambda _: 'macros'),
     ('Monitor', lambda _: 'monitors.0'),
     ('MonitorManager', lambda _: 'monitors'),
     ('Panel', create_panel),
     ('Root', lambda _: ''),
+    ('RuleObject', create_rule),
     ('Settings', lambda _: 'settings'),
     ('TagManager', lambda _: 'tags'),
     ('Theme', lambda _: 'theme'),
+    ('Timer', create_timer),
+    ('TimerManager', lambda _: 'timers'),
     ('TypesDoc', lambda _: 'types'),
 ]
 
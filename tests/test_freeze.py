@@ -0,0 +1,99 @@
+from test_herbstclient import HcBinPipe
+
+
+def test_freeze_nested_and_released_with_connection(hlwm):
+    proc = hlwm.call('chain , freeze , freeze , get_attr freeze.level')
+    assert proc.stdout == '2'
+
+    # the freezes are released when the herbstclient connection closes
+    assert hlwm.attr.freeze.level() == '0'
+
+
+def test_thaw_without_freeze(hlwm):
+    hlwm.call_xfail('thaw') \
+        .expect_stderr('not frozen')
+
+
+def test_thaw_releases_one_freeze(hlwm):
+    proc = hlwm.call('chain , freeze , freeze , thaw , get_attr freeze.level')
+    assert proc.stdout == '1'
+
+
+def test_freeze_locks_monitors(hlwm):
+    proc = hlwm.call('chain , freeze , get_attr settings.monitors_locked')
+    assert proc.stdout == '1'
+
+    assert hlwm.attr.settings.monitors_locked() == '0'
+
+
+def test_freeze_coalesces_hooks(hlwm, hc_idle):
+    hlwm.call('chain , freeze '
+              ', emit_hook foo , emit_hook bar , emit_hook foo '
+              ', add tag2 , use tag2 , use_index 0 , use tag2 '
+              ', thaw')
+
+    hooks = hc_idle.hooks()
+    assert hooks.count(['foo']) == 1
+    assert hooks.count(['bar']) == 1
+    assert hooks.count(['tag_changed', 'tag2', '0']) == 1
+    assert ['tag_changed', 'default', '0'] not in hooks
+    assert hooks[-1] == ['tag_changed', 'tag2', '0']
+
+
+def test_freeze_drops_undone_attribute_changes(hlwm, hc_idle):
+    hlwm.call('new_attr int my_a 0')
+    hlwm.call('new_attr int my_b 0')
+    hlwm.call('watch my_a')
+    hlwm.call('watch my_b')
+    bin_pipe = HcBinPipe()
+    for cmd in [['freeze'],
+                ['set_attr', 'my_a', '1'],
+                ['set_attr', 'my_a', '2'],
+                ['set_attr', 'my_b', '1'],
+                ['set_attr', 'my_b', '0'],
+                ['thaw']]:
+        args = sum([['ARG', a] for a in cmd], [])
+        bin_pipe.send(*args, 'RUN')
+        bin_pipe.expect('STDOUT', '', 'STDERR', '', 'STATUS', '0')
+
+    hooks = hc_idle.hooks()
+    changes = [h for h in hooks if h[0] == 'attribute_changed']
+    assert changes == [['attribute_changed', 'my_a', '0', '2']]
+
+
+def test_freeze_held_by_binary_pipe(hlwm, hc_idle):
+    bin_pipe = HcBinPipe()
+    bin_pipe.send('ARG', 'freeze', 'RUN')
+    bin_pipe.expect('STDOUT', '', 'STDERR', '', 'STATUS', '0')
+    hlwm.call('emit_hook foo')
+
+    assert hlwm.attr.freeze.level() == '1'
+    assert int(hlwm.attr.freeze.pending_hooks()) >= 1
+
+    # closing the pipe releases the freeze and emits the hooks
+    bin_pipe.proc.stdin.close()
+    bin_pipe.expect_eof()
+
+    assert hlwm.attr.freeze.level() == '0'
+    assert ['foo'] in hc_idle.hooks()
+
+
+def test_closed_connection_keeps_freezes_of_others(hlwm):
+    client_a = HcBinPipe()
+    client_a.send('ARG', 'freeze', 'RUN')
+    client_a.expect('STDOUT', '', 'STDERR', '', 'STATUS', '0')
+    # another client releases the freeze of A
+    hlwm.call('thaw')
+    assert hlwm.attr.freeze.level() == '0'
+    client_b = HcBinPipe()
+    client_b.send('ARG', 'freeze', 'RUN')
+    client_b.expect('STDOUT', '', 'STDERR', '', 'STATUS', '0')
+
+    # A holds no freeze anymore, so closing it must not release that of B
+    client_a.proc.stdin.close()
+    client_a.expect_eof()
+
+    assert hlwm.attr.freeze.level() == '1'
+    client_b.proc.stdin.close()
+    client_b.expect_eof()
+    assert hlwm.attr.freeze.level() == '0'
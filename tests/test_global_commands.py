@@ -33,6 +33,34 @@ def test_tag_status_multi_monitor(hlwm):
     assert hlwm.call('tag_status 1').stdout == '\t-default\t#othermon\t.d1\t.d2\t.d3\t'
 
 
+def test_tag_status_updates(hlwm, x11):
+    hlwm.call('add foo')
+    hlwm.call('add bar')
+    assert hlwm.call('tag_status').stdout == '\t#default\t.foo\t.bar\t'
+
+    handle, winid = x11.create_client()
+    assert hlwm.call('tag_status').stdout == '\t#default\t.foo\t.bar\t'
+    hlwm.call(['move', 'foo'])
+    assert hlwm.call('tag_status').stdout == '\t#default\t:foo\t.bar\t'
+    hlwm.attr.clients[winid].urgent = True
+    assert hlwm.call('tag_status').stdout == '\t#default\t!foo\t.bar\t'
+    assert hlwm.attr.tags[1].urgent_count() == 1
+    hlwm.attr.clients[winid].urgent = False
+    assert hlwm.attr.tags[1].urgent_count() == 0
+
+    hlwm.call('rename foo renamed')
+    assert hlwm.call('tag_status').stdout == '\t#default\t:renamed\t.bar\t'
+    hlwm.call('use renamed')
+    assert hlwm.call('tag_status').stdout == '\t.default\t#renamed\t.bar\t'
+    hlwm.call('use default')
+    handle.unmap()
+    x11.sync_with_hlwm()
+    assert winid not in hlwm.list_children('clients')
+    assert hlwm.call('tag_status').stdout == '\t#default\t.renamed\t.bar\t'
+    hlwm.call('merge_tag bar')
+    assert hlwm.call('tag_status').stdout == '\t#default\t.renamed\t'
+
+
 def test_tag_status_completion(hlwm):
     monname = 'monitor_name'
     assert '0' in hlwm.complete('tag_status')
@@ -0,0 +1,88 @@
+import pytest
+
+
+def changes_since(hlwm, generation):
+    lines = hlwm.call(['changes_since', generation]).stdout.splitlines()
+    changes = [line.split(' ', 2) for line in lines[1:]]
+    return int(lines[0]), changes
+
+
+def test_journal_generation_counts_changes(hlwm):
+    generation = int(hlwm.attr.journal.generation())
+
+    hlwm.call('new_attr string my_foo')
+    hlwm.call('set_attr my_foo bar')
+
+    new_generation, changes = changes_since(hlwm, generation)
+    assert new_generation == int(hlwm.attr.journal.generation())
+    assert changes == [
+        [str(generation + 1), 'attribute_changed', 'my_foo'],
+    ]
+
+
+def test_journal_child_events(hlwm):
+    generation = int(hlwm.attr.journal.generation())
+
+    hlwm.call('add foo')
+    hlwm.call('merge_tag foo')
+
+    _, changes = changes_since(hlwm, generation)
+    events = [c[1:] for c in changes]
+    assert ['child_added', 'tags.1'] in events
+    assert ['child_added', 'tags.by-name.foo'] in events
+    assert ['child_removed', 'tags.1'] in events
+    assert events.index(['child_added', 'tags.1']) \
+        < events.index(['child_removed', 'tags.1'])
+
+
+def test_journal_uses_canonical_path(hlwm, x11):
+    _, winid = x11.create_client()
+    generation = int(hlwm.attr.journal.generation())
+
+    hlwm.call('set_attr clients.focus.pseudotile on')
+
+    _, changes = changes_since(hlwm, generation)
+    events = [c[1:] for c in changes]
+    assert ['attribute_changed', f'clients.{winid}.pseudotile'] in events
+    assert ['attribute_changed', 'clients.focus.pseudotile'] not in events
+
+
+def test_journal_up_to_date(hlwm):
+    generation = hlwm.attr.journal.generation()
+
+    assert hlwm.call(['changes_since', generation]).stdout == generation + '\n'
+
+
+@pytest.mark.parametrize('too_old', [True, False])
+def test_journal_resync(hlwm, too_old):
+    hlwm.call('new_attr int my_attr')
+    hlwm.attr.journal.capacity = 3
+    generation = int(hlwm.attr.journal.generation())
+    if not too_old:
+        # a generation from the future
+        generation += 100
+
+    for i in range(1, 6):
+        hlwm.call(f'set_attr my_attr {i}')
+
+    output = hlwm.call(['changes_since', generation]).stdout.splitlines()
+    assert output[1:] == ['resync']
+    assert hlwm.attr.journal.size() == '3'
+
+
+def test_journal_capacity(hlwm):
+    hlwm.call('new_attr int my_first')
+    hlwm.call('new_attr int my_second')
+    hlwm.attr.journal.capacity = 2
+    generation = int(hlwm.attr.journal.generation())
+
+    hlwm.call('set_attr my_first 1')
+    hlwm.call('set_attr my_second 2')
+
+    _, changes = changes_since(hlwm, generation)
+    assert [c[1:] for c in changes] == [
+        ['attribute_changed', 'my_first'],
+        ['attribute_changed', 'my_second'],
+    ]
+    assert hlwm.call(['changes_since', generation - 1]).stdout.splitlines()[1] \
+        == 'resync'
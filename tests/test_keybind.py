@@ -1,5 +1,6 @@
 import pytest
 import subprocess
+import time
 
 from conftest import PROCESS_SHUTDOWN_TIME
 
@@ -527,3 +528,73 @@ def test_client_does_not_see_bound_key(hlwm, keyboard, bind_press, bind_release,
             assert False, "Expected client to quit, but it is still running"
     else:
         assert hlwm.attr.my_test() == "grabbed"
+
+
+def test_list_key_chords(hlwm):
+    hlwm.call('keybind x quit')
+    hlwm.call(['keybind', 'Mod1-i 1', 'use_index', '0'])
+    hlwm.call(['keybind', 'Mod1-i  2', 'use_index', '1'])
+
+    keybinds = hlwm.call('list_keybinds')
+
+    assert keybinds.stdout == 'x\tquit\nMod1+i 1\tuse_index\t0\nMod1+i 2\tuse_index\t1\n'
+
+
+def test_key_chord_replaces_prefix_binding(hlwm):
+    hlwm.call('keybind Mod1-i quit')
+    hlwm.call(['keybind', 'Mod1-i 1', 'use_index', '0'])
+    assert hlwm.call('list_keybinds').stdout == 'Mod1+i 1\tuse_index\t0\n'
+
+    hlwm.call('keybind Mod1-i quit')
+    assert hlwm.call('list_keybinds').stdout == 'Mod1+i\tquit\n'
+
+
+def test_keyunbind_key_chord(hlwm):
+    hlwm.call(['keybind', 'Mod1-i 1', 'use_index', '0'])
+    hlwm.call(['keybind', 'Mod1-i 2', 'use_index', '1'])
+
+    hlwm.call(['keyunbind', 'Mod1-i 1'])
+    assert hlwm.call('list_keybinds').stdout == 'Mod1+i 2\tuse_index\t1\n'
+
+    hlwm.call(['keyunbind', 'Mod1-i 2'])
+    assert hlwm.call('list_keybinds').stdout == ''
+    hlwm.call_xfail(['keyunbind', 'Mod1-i 2']) \
+        .expect_stderr('keyunbind: Key "Mod1\\+i 2" is not bound\n')
+
+
+def test_trigger_key_chord(hlwm, keyboard):
+    hlwm.call('add tag2')
+    hlwm.call(['keybind', 'x y', 'use', 'tag2'])
+
+    keyboard.press('y')
+    assert hlwm.get_attr('monitors.0.tag') != 'tag2'
+    keyboard.press('x')
+    assert hlwm.get_attr('monitors.0.tag') != 'tag2'
+    keyboard.press('y')
+
+    assert hlwm.get_attr('monitors.0.tag') == 'tag2'
+
+
+def test_key_chord_aborted_by_other_key(hlwm, keyboard):
+    hlwm.call('add tag2')
+    hlwm.call(['keybind', 'x y', 'use', 'tag2'])
+
+    keyboard.press('x')
+    keyboard.press('z')
+    keyboard.press('y')
+
+    assert hlwm.get_attr('monitors.0.tag') != 'tag2'
+
+
+def test_key_chord_timeout(hlwm, keyboard):
+    hlwm.call('add tag2')
+    hlwm.call(['keybind', 'x y', 'use', 'tag2'])
+    hlwm.attr.settings.keychord_timeout = 100
+
+    keyboard.press('x')
+    time.sleep(0.3)
+    # let the main loop process the timeout
+    hlwm.call('true')
+    keyboard.press('y')
+
+    assert hlwm.get_attr('monitors.0.tag') != 'tag2'
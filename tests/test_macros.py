@@ -0,0 +1,102 @@
+import pytest
+
+
+def test_macro_define_and_call(hlwm):
+    hlwm.call('macro define greet WHO WHAT -- echo WHAT WHO')
+
+    assert hlwm.call('macro call greet world hello').stdout == 'hello world\n'
+    assert hlwm.call('macro call greet A B').stdout == 'B A\n'
+    assert hlwm.attr.macros.count() == '1'
+    assert hlwm.attr.macros.greet.parameters() == 'WHO WHAT'
+    assert hlwm.attr.macros.greet.command() == 'echo WHAT WHO'
+    assert hlwm.attr.macros.greet.call_count() == '2'
+
+
+def test_macro_without_parameters(hlwm):
+    hlwm.call('macro define addtag -- add foo')
+
+    hlwm.call('macro call addtag')
+
+    assert 'foo' in hlwm.list_children('tags.by-name')
+
+
+def test_macro_redefine(hlwm):
+    hlwm.call('macro define m X -- echo first X')
+    hlwm.call('macro define m -- echo second')
+
+    assert hlwm.call('macro call m').stdout == 'second\n'
+    assert hlwm.attr.macros.count() == '1'
+
+
+def test_macro_remove(hlwm):
+    hlwm.call('macro define m -- true')
+
+    hlwm.call('macro remove m')
+
+    assert hlwm.attr.macros.count() == '0'
+    hlwm.call_xfail('macro call m') \
+        .expect_stderr('no such macro: m')
+    hlwm.call_xfail('macro remove m') \
+        .expect_stderr('no such macro: m')
+
+
+def test_macro_removing_itself(hlwm):
+    hlwm.call('macro define m -- macro remove m')
+
+    hlwm.call('macro call m')
+
+    assert hlwm.attr.macros.count() == '0'
+
+
+def test_macro_call_wrong_number_of_values(hlwm):
+    hlwm.call('macro define m X -- echo X')
+
+    hlwm.call_xfail('macro call m') \
+        .expect_stderr('not enough arguments')
+    hlwm.call_xfail('macro call m a b') \
+        .expect_stderr('expects 1 arguments but got 2')
+    assert hlwm.attr.macros.m.call_count() == '0'
+
+
+@pytest.mark.parametrize('cmd,message', [
+    ('macro define m X echo X', 'not enough arguments'),
+    ('macro define m --', 'not enough arguments'),
+    ('macro define m -- nonexisting', 'the command "nonexisting" does not exist'),
+    ('macro define m.n -- true', 'invalid macro name'),
+    ('macro define -- true', 'Expected one argument, but got only 0'),
+])
+def test_macro_define_invalid(hlwm, cmd, message):
+    hlwm.call_xfail(cmd).expect_stderr(message)
+    assert hlwm.attr.macros.count() == '0'
+
+
+@pytest.mark.parametrize('cmd,message', [
+    ('macro', 'Expected one argument, but got only 0'),
+    ('macro foo', 'Expecting one of: define, call, remove'),
+    ('macro call', 'Expected one argument, but got only 0'),
+    ('macro remove m extra', 'too many arguments'),
+])
+def test_macro_invalid_arguments(hlwm, cmd, message):
+    hlwm.call('macro define m -- true')
+
+    hlwm.call_xfail(cmd).expect_stderr(message)
+    assert hlwm.attr.macros.count() == '1'
+
+
+def test_macro_recursion_is_limited(hlwm):
+    hlwm.call('macro define m -- macro call m')
+
+    hlwm.call_xfail('macro call m') \
+        .expect_stderr('too many nested macro calls')
+
+
+def test_macro_completion(hlwm):
+    hlwm.call('macro define m X -- true')
+
+    assert hlwm.complete(['macro']) == sorted(['call', 'define', 'remove'])
+    assert hlwm.complete(['macro', 'call']) == ['m']
+    assert hlwm.complete(['macro', 'remove']) == ['m']
+    hlwm.command_has_all_args(['macro', 'remove', 'm'])
+    hlwm.command_has_all_args(['macro', 'call', 'm', 'value'])
+    assert '--' in hlwm.complete(['macro', 'define', 'n', 'X'])
+    assert 'echo' in hlwm.complete(['macro', 'define', 'n', 'X', '--'])
@@ -1,3 +1,4 @@
+import json
 import pytest
 import re
 
@@ -47,6 +48,62 @@ def test_object_tree_completion(hlwm):
     hlwm.command_has_all_args(['object_tree', 'tags'])
 
 
+def test_dump_tree_json(hlwm):
+    hlwm.call('add foo')
+    hlwm.call(['new_attr', 'string', 'tags.1.my_str', '"quoted"\\text'])
+
+    dump = json.loads(hlwm.call('dump_tree tags. tags.count').stdout)
+
+    assert list(dump.keys()) == ['tags', 'tags.count']
+    assert dump['tags.count'] == {'type': 'int', 'value': '2'}
+    tag = dump['tags']['children']['1']
+    assert tag['attributes']['name'] == {'type': 'string', 'value': 'foo'}
+    assert tag['attributes']['my_str']['value'] == '"quoted"\\text'
+    assert 'tiling' in tag['children']
+    assert dump['tags']['children']['by-name']['children']['foo'] == tag
+
+
+def test_dump_tree_binary(hlwm):
+    hlwm.call('add foo')
+    output = hlwm.call('dump_tree --format=binary tags.1').stdout
+
+    def netstrings(data):
+        while data:
+            length, data = data.split(':', 1)
+            yield data[:int(length)]
+            assert data[int(length)] == ','
+            data = data[int(length) + 1:]
+
+    fields = list(netstrings(output))
+    records = [fields[i:i + 3] for i in range(0, len(fields), 3)]
+    assert records[0] == ['tags.1', 'object', '']
+    assert ['tags.1.name', 'string', 'foo'] in records
+    assert ['tags.1.tiling', 'object', ''] in records
+    for path, attr_type, value in records:
+        if attr_type != 'object':
+            assert hlwm.get_attr(path) == value
+            assert hlwm.call(['attr_type', path]).stdout == attr_type + '\n'
+
+
+def test_dump_tree_everything(hlwm):
+    dump = json.loads(hlwm.call('dump_tree').stdout)
+    assert dump[''] == json.loads(hlwm.call('dump_tree .').stdout)['']
+    assert 'settings' in dump['']['children']
+
+
+def test_dump_tree_invalid_arg(hlwm):
+    hlwm.call_xfail('dump_tree tags.count nonexistent') \
+        .expect_stderr('No such object or attribute: nonexistent')
+    hlwm.call_xfail('dump_tree --format=foo') \
+        .expect_stderr('Expecting one of: json, binary')
+
+
+def test_dump_tree_completion(hlwm):
+    assert '--format=' in hlwm.complete(['dump_tree'], partial=True)
+    assert 'tags.' in hlwm.complete(['dump_tree'], partial=True)
+    assert 'tags.count ' in hlwm.complete(['dump_tree', 'tags.'], partial=True, position=1)
+
+
 def test_substitute(hlwm):
     expected_output = hlwm.get_attr('tags.count') + '\n'
 
@@ -318,6 +375,20 @@ def test_sprintf_foreach_list_tag_names(hlwm):
     assert hlwm.call(command).stdout == 'tag0\nothertag\nlasttag\n'
 
 
+def test_sprintf_repeated_after_tree_changes(hlwm):
+    hlwm.call('new_attr string my_foo first')
+    cmd = 'sprintf S "%s %s" my_foo clients.focus.winid echo S'
+    hlwm.call_xfail(cmd).expect_stderr('No such object clients.focus')
+
+    winid, _ = hlwm.create_client()
+    assert hlwm.call(cmd).stdout == f'first {winid}\n'
+
+    hlwm.call('remove_attr my_foo')
+    hlwm.call_xfail(cmd).expect_stderr('has no attribute "my_foo"')
+    hlwm.call('new_attr string my_foo second')
+    assert hlwm.call(cmd).stdout == f'second {winid}\n'
+
+
 def test_disjoin_rects(hlwm):
     # test the example from the manpage
     expected = '\n'.join((
@@ -947,6 +1018,34 @@ def test_foreach_recursive_lists_layout(hlwm):
         assert len(foreach_lines) == len(layout_lines)
 
 
+def test_foreach_recursive_survives_removed_objects(hlwm):
+    hlwm.call('split explode')
+
+    # when visiting the split, 'remove' replaces it by the remaining frame.
+    # So the split and the removed frame are deleted after their paths
+    # have been collected
+    proc = hlwm.call(['foreach', 'F', 'tags.focus.tiling', '--recursive',
+                      'chain', ',', 'and', '+', 'silent', 'get_attr', 'F.fraction',
+                      '+', 'remove', ',', 'echo', 'F'])
+
+    lines = proc.stdout.splitlines()
+
+    # all paths are collected before the first command runs, so the
+    # command is also called for the paths of the deleted frames
+    assert lines[0:2] == ['tags.focus.tiling', 'tags.focus.tiling.focused_frame']
+    assert 'tags.focus.tiling.root' in lines
+    assert [p for p in lines if p.startswith('tags.focus.tiling.root.')] != []
+    assert hlwm.attr.tags.focus.frame_count() == 1
+
+
+def test_foreach_does_not_visit_objects_created_by_command(hlwm):
+    proc = hlwm.call(['foreach', 'T', 'tags.by-name.',
+                      'chain', ',', 'silent', 'add', 'othertag', ',', 'echo', 'T'])
+
+    assert proc.stdout.splitlines() == ['tags.by-name.default']
+    assert hlwm.attr.tags.count() == 2
+
+
 def test_foreach_recursive_filter_name(hlwm):
     # create more tags
     hlwm.call('add tag1')
@@ -122,6 +122,37 @@ def test_drag_move(hlwm, x11, mouse, repeat):
     assert (r.x, r.y) == (x + 12, y + 15)
 
 
+@pytest.mark.parametrize('other_exists_before_drag', [True, False])
+def test_drag_move_snaps_to_other_window(hlwm, mouse, other_exists_before_drag):
+    hlwm.call('move_monitor 0 800x600+0+0')
+    hlwm.attr.tags.focus.floating = True
+    hlwm.attr.theme.border_width = 0
+    hlwm.attr.settings.snap_gap = 0
+    hlwm.attr.settings.snap_distance = 10
+
+    def create_other():
+        other, _ = hlwm.create_client()
+        hlwm.attr.clients[other].sizehints_floating = False
+        hlwm.attr.clients[other].floating_geometry = '300x200+400+300'
+
+    if other_exists_before_drag:
+        create_other()
+    winid, _ = hlwm.create_client()
+    hlwm.attr.clients[winid].sizehints_floating = False
+    hlwm.attr.clients[winid].floating_geometry = '100x100+100+100'
+    mouse.move_into(winid, wait=True)
+    hlwm.call(['drag', winid, 'move'])
+    if not other_exists_before_drag:
+        create_other()
+    # move the window such that its right edge is 5 pixels
+    # left of the other window
+    mouse.move_relative(195, 220)
+    hlwm.call('true')  # sync
+
+    geo = hlwm.attr.clients[winid].floating_geometry()
+    assert (geo.x, geo.y) == (300, 320)
+
+
 @pytest.mark.parametrize('update_dragged', [True, False])
 def test_drag_move_sends_configure(hlwm, x11, mouse, update_dragged):
     hlwm.attr.tags.focus.floating = 'on'
@@ -204,6 +235,41 @@ def test_drag_resize_tiled_client(hlwm, mouse, align):
     assert math.isclose(actual, expected, abs_tol=0.01)
 
 
+def test_drag_resize_tiled_client_only_updates_subtree(hlwm, mouse):
+    left, _ = hlwm.create_client()
+    top, _ = hlwm.create_client()
+    bottom, _ = hlwm.create_client()
+    layout = f"""
+        (split horizontal:0.5:1
+            (clients max:0 {left})
+            (split vertical:0.5:0
+                (clients max:0 {top})
+                (clients max:0 {bottom})))
+    """
+    hlwm.call(['load', layout])
+
+    def geometries():
+        return [hlwm.attr.clients[w].decoration_geometry() for w in [left, top, bottom]]
+
+    geo_before = geometries()
+    # move the cursor close to the bottom edge of the top client
+    mouse.move_into(top, x=geo_before[1].width // 2, y=geo_before[1].height - 5, wait=False)
+    hlwm.call(['drag', top, 'resize'])
+    assert hlwm.get_attr('clients.dragged.winid') == top
+    mouse.move_relative(0, 60)
+
+    geo_during = geometries()
+    assert geo_during[0] == geo_before[0]
+    assert geo_during[1].height == geo_before[1].height + 60
+    assert geo_during[2].height == geo_before[2].height - 60
+
+    # a full relayout gives the same result
+    frame_gap = int(hlwm.attr.settings.frame_gap())
+    hlwm.attr.settings.frame_gap = frame_gap + 1
+    hlwm.attr.settings.frame_gap = frame_gap
+    assert geometries() == geo_during
+
+
 @pytest.mark.parametrize('dir1', ['left', 'right'])
 @pytest.mark.parametrize('dir2', ['top', 'bottom'])
 def test_drag_resize_tiled_client_in_two_directions(hlwm, mouse, dir1, dir2):
@@ -403,6 +469,31 @@ def test_resize_unfocused_client(hlwm, mouse, floating):
             "the tiling layout is updated"
 
 
+def test_drag_refresh_rate_applies_final_position(hlwm, x11, mouse):
+    # allow only one update per second
+    hlwm.attr.settings.drag_refresh_rate = 1
+    hlwm.call('attr theme.padding_top 20')
+    client, winid = x11.create_client(geometry=(50, 50, 300, 200))
+    hlwm.call(f'set_attr clients.{winid}.floating true')
+    x_before, y_before = x11.get_absolute_top_left(client)
+    mouse.move_to(x_before + 10, y_before - 10)  # a bit into the padding
+    mouse.mouse_press('1')
+    assert hlwm.get_attr('clients.dragged.winid') == winid
+
+    # the first motion is applied immediately
+    mouse.move_relative(30, 20)
+    assert x11.get_absolute_top_left(client) == (x_before + 30, y_before + 20)
+    # further motions within the same second are postponed
+    mouse.move_relative(40, 10)
+    assert x11.get_absolute_top_left(client) == (x_before + 30, y_before + 20)
+
+    # but the final position is applied on release
+    mouse.mouse_release('1')
+    x11.display.sync()
+    assert 'dragged' not in hlwm.list_children('clients')
+    assert x11.get_absolute_top_left(client) == (x_before + 70, y_before + 30)
+
+
 @pytest.mark.parametrize('resize_possible', [True, False])
 def test_border_click_either_focuses_or_resizes(hlwm, mouse, resize_possible):
     """
@@ -0,0 +1,72 @@
+import pytest
+
+# the names of the tags against which the regexes are matched
+TAG_NAMES = [
+    'default', 'a', 'ab', 'aax', 'bx', 'dx', ']x', '-x', 'x', '123', 'a_b',
+    'a b', 'aa', 'aaa', 'aaaa', 'abab', 'foo', 'bar', 'ba', 'foor', 'fooo',
+]
+
+
+def matching_tag_names(hlwm, regex):
+    """return the names of all tags that entirely match the regex,
+    as reported by 'foreach --filter-name'"""
+    prefix = 'tags.by-name.'
+    proc = hlwm.call(['foreach', 'T', 'tags.by-name.',
+                      '--filter-name=' + regex, 'echo', 'T'])
+    names = []
+    for line in proc.stdout.splitlines():
+        assert line.startswith(prefix)
+        names.append(line[len(prefix):])
+    return sorted(names)
+
+
+@pytest.mark.parametrize('regex,expected', [
+    # anchors
+    ('^ab$', ['ab']),
+    ('a^b', []),
+    ('ab$|^x', ['ab', 'x']),
+    # bracket expressions
+    ('[a-c]x', ['bx']),
+    ('[^a-c]x', ['-x', ']x', 'dx']),
+    ('[]a]x', [']x']),
+    ('[a-]x', ['-x']),
+    # character classes
+    ('[[:digit:]]+', ['123']),
+    ('[[:alpha:]_]*', [t for t in TAG_NAMES if t not in ['123', 'a b', ']x', '-x']]),
+    ('[^[:space:]]+', [t for t in TAG_NAMES if t != 'a b']),
+    # bounded repeats
+    ('a{2}', ['aa']),
+    ('a{1,3}', ['a', 'aa', 'aaa']),
+    ('a{3,}', ['aaa', 'aaaa']),
+    ('(ab){2}', ['abab']),
+    ('fo{2}r?', ['foo', 'foor']),
+    # alternation
+    ('foo|bar', ['bar', 'foo']),
+    ('(foo|ba)r?', ['ba', 'bar', 'foo', 'foor']),
+    # constructs that are handled by std::regex
+    ('[[.a.]]b', ['ab']),
+    ('[[=a=]]+', ['a', 'aa', 'aaa', 'aaaa']),
+    ('a|', ['a']),
+    ('x()', ['x']),
+])
+def test_regex_matches_entire_name(hlwm, regex, expected):
+    for name in TAG_NAMES[1:]:
+        hlwm.call(['add', name])
+
+    assert matching_tag_names(hlwm, regex) == sorted(expected)
+
+
+@pytest.mark.parametrize('regex,message', [
+    ('(ab', "Mismatched '(' and ')' in regular expression"),
+    ('ab)', "Mismatched '(' and ')' in regular expression"),
+    ('[ab', "Unexpected character within '[...]' in regular expression"),
+    ('a{2,1}', "Invalid range in '{}' in regular expression"),
+    ('[b-a]', 'Invalid range in bracket expression.'),
+    ('[[:foo:]]', 'Invalid character class.'),
+    ('(a)\\2', 'Invalid escape in regular expression'),
+    ('a\\', 'Invalid escape at end of regular expression'),
+])
+def test_regex_error_message(hlwm, regex, message):
+    # the messages are those of std::regex in libstdc++
+    hlwm.call_xfail(['foreach', 'T', 'tags.', '--filter-name=' + regex, 'true']) \
+        .expect_stderr(message, regex=False)
@@ -332,6 +332,76 @@ def test_condition_class(hlwm):
     assert hlwm.get_attr('clients', winid, 'tag') == 'tag2'
 
 
+def test_rule_order_indexed_and_unindexed(hlwm, x11):
+    for tag in ['tag1', 'tag2', 'tag3', 'tag4']:
+        hlwm.call(['add', tag])
+    # rules with an exact class condition and other rules must
+    # still be applied in the order of the rule list
+    hlwm.call('rule class=myclass tag=tag1')
+    hlwm.call('rule title~.* tag=tag2')
+    hlwm.call('rule once instance=myinst tag=tag3')
+    hlwm.call('rule prepend class=myclass tag=tag4')
+    hlwm.call('rule class=otherclass tag=tag4')
+
+    _, winid = x11.create_client(wm_class=('myinst', 'myclass'))
+    assert hlwm.attr.clients[winid].tag() == 'tag3'
+    # the 'once' rule is gone, the prepended rule is overwritten
+    _, winid = x11.create_client(wm_class=('myinst', 'myclass'))
+    assert hlwm.attr.clients[winid].tag() == 'tag2'
+    assert hlwm.call('list_rules').stdout == \
+        'label=3\tclass=myclass\ttag=tag4\t\n' + \
+        'label=0\tclass=myclass\ttag=tag1\t\n' + \
+        'label=1\ttitle~.*\ttag=tag2\t\n' + \
+        'label=4\tclass=otherclass\ttag=tag4\t\n'
+
+
+def test_rule_index_after_unrule(hlwm, x11):
+    hlwm.call('add tag2')
+    hlwm.call('rule label=foo class=myclass tag=tag2')
+    hlwm.call('unrule foo')
+
+    _, winid = x11.create_client(wm_class=('myinst', 'myclass'))
+
+    assert hlwm.attr.clients[winid].tag() == 'default'
+
+
+def test_rule_statistics(hlwm, x11):
+    hlwm.call('rule label=foo class=myclass')
+    hlwm.call('rule label=bar title=nomatch')
+    assert hlwm.attr.rules.count() == 2
+    assert hlwm.attr.rules[0].match_count() == 0
+    assert hlwm.attr.rules[0].last_match() == '0x0'
+
+    _, winid = x11.create_client(wm_class=('myinst', 'myclass'))
+    x11.create_client(wm_class=('myinst', 'other'))
+
+    foo = hlwm.attr.rules[0]
+    assert foo.label() == 'foo'
+    assert foo.evaluation_count() == 1
+    assert foo.match_count() == 1
+    assert foo.last_match() == winid
+    bar = hlwm.attr.rules[1]
+    assert bar.label() == 'bar'
+    assert bar.evaluation_count() == 2
+    assert bar.match_count() == 0
+
+
+def test_rule_objects_follow_evaluation_order(hlwm):
+    hlwm.call('rule label=a class=a')
+    hlwm.call('rule label=b class=b')
+    hlwm.call('rule prepend label=c class=c')
+    assert [hlwm.attr.rules[i].label() for i in range(0, 3)] == ['c', 'a', 'b']
+
+    hlwm.call('unrule a')
+    assert hlwm.attr.rules.count() == 2
+    assert [hlwm.attr.rules[i].label() for i in range(0, 2)] == ['c', 'b']
+    hlwm.call_xfail('get_attr rules.2.label').expect_stderr('no child')
+
+    hlwm.call('unrule --all')
+    assert hlwm.attr.rules.count() == 0
+    hlwm.call_xfail('get_attr rules.0.label').expect_stderr('no child')
+
+
 @pytest.mark.parametrize('rulearg,errormsg', [
     ("fullscreen=foo", 'only.*are valid booleans'),
     ("keymask=(", r'(Parenthesis is not closed|Mismatched.*\(.*\).*in regular)'),
@@ -0,0 +1,175 @@
+import os
+import pytest
+import signal
+import time
+
+
+def test_timer_calls_command_periodically(hlwm):
+    hlwm.call('new_attr int my_ticks 0')
+    hlwm.call('timer add tick 50 set_attr my_ticks +=1')
+
+    time.sleep(0.4)
+
+    assert hlwm.attr.timers.tick.running() == 'true'
+    ticks = int(hlwm.attr.my_ticks())
+    assert ticks >= 3
+    assert int(hlwm.attr.timers.tick.fire_count()) == ticks
+
+
+def test_timer_once(hlwm):
+    hlwm.call('new_attr int my_ticks 0')
+    hlwm.call('timer add tick 50 --once set_attr my_ticks +=1')
+    assert hlwm.attr.timers.tick.once() == 'true'
+
+    time.sleep(0.3)
+
+    assert hlwm.attr.my_ticks() == '1'
+    assert hlwm.attr.timers.tick.running() == 'false'
+
+
+def test_timer_stop_and_start(hlwm):
+    hlwm.call('new_attr int my_ticks 0')
+    hlwm.call('timer add tick 50 set_attr my_ticks +=1')
+    hlwm.call('timer stop tick')
+    assert hlwm.attr.timers.tick.running() == 'false'
+
+    time.sleep(0.2)
+    assert hlwm.attr.my_ticks() == '0'
+
+    hlwm.call('timer start tick')
+    assert hlwm.attr.timers.tick.running() == 'true'
+    time.sleep(0.2)
+    assert int(hlwm.attr.my_ticks()) >= 1
+
+
+def test_timer_running_attribute(hlwm):
+    hlwm.call('new_attr int my_ticks 0')
+    hlwm.call('timer add tick 50 set_attr my_ticks +=1')
+
+    hlwm.attr.timers.tick.running = 'false'
+    time.sleep(0.2)
+
+    assert hlwm.attr.my_ticks() == '0'
+
+
+def test_timer_removing_itself(hlwm):
+    # the timer is destroyed while its own command is still running
+    hlwm.call('timer add foo 50 timer remove foo')
+
+    time.sleep(0.2)
+
+    assert hlwm.attr.timers.count() == '0'
+
+
+def test_timer_remove(hlwm):
+    hlwm.call('timer add foo 100000 true')
+    assert hlwm.attr.timers.count() == '1'
+
+    hlwm.call('timer remove foo')
+
+    assert hlwm.attr.timers.count() == '0'
+    hlwm.call_xfail('timer remove foo') \
+        .expect_stderr('no such timer: foo')
+
+
+@pytest.mark.parametrize('cmd,message', [
+    ('timer add foo 0 true', 'interval must be positive'),
+    ('timer add foo bar true', 'Cannot parse argument'),
+    ('timer add foo 100 nonexisting', 'the command "nonexisting" does not exist'),
+    ('timer add foo.bar 100 true', 'invalid timer name'),
+    ('timer add foo', 'Expected between 2 and 3 arguments'),
+    ('timer foo', 'Expecting one of: add, remove, start, stop'),
+    ('timer stop', 'Expected one argument, but got only 0'),
+    ('timer start foo', 'no such timer: foo'),
+    ('timer remove foo bar', 'too many arguments'),
+])
+def test_timer_invalid(hlwm, cmd, message):
+    hlwm.call_xfail(cmd).expect_stderr(message)
+    assert hlwm.attr.timers.count() == '0'
+
+
+def test_timer_add_existing(hlwm):
+    hlwm.call('timer add foo 100000 true')
+
+    hlwm.call_xfail('timer add foo 100000 true') \
+        .expect_stderr('already exists')
+
+
+def test_timer_interval_must_be_positive(hlwm):
+    hlwm.call('timer add foo 100000 true')
+
+    hlwm.call_xfail('set_attr timers.foo.interval 0') \
+        .expect_stderr('interval must be positive')
+
+
+def test_timer_keeps_its_rate(hlwm):
+    # the exact number of calls depends on the load of the machine, so
+    # only check that the timer does not fall far behind its interval
+    hlwm.call('timer add tick 50 true')
+
+    time.sleep(1.0)
+
+    assert int(hlwm.attr.timers.tick.fire_count()) >= 5
+
+
+def test_timer_skips_missed_ticks(hlwm, hlwm_process):
+    hlwm.call('timer add tick 50 true')
+    time.sleep(0.1)
+    fire_count = int(hlwm.attr.timers.tick.fire_count())
+
+    # while herbstluftwm is stopped, about twenty deadlines pass
+    os.kill(hlwm_process.proc.pid, signal.SIGSTOP)
+    time.sleep(1.0)
+    os.kill(hlwm_process.proc.pid, signal.SIGCONT)
+
+    # they are not caught up on. Catching up would call the command
+    # about twenty times; allow a few calls for a slow machine
+    fire_count_after_resume = int(hlwm.attr.timers.tick.fire_count())
+    assert fire_count_after_resume - fire_count < 10
+    # and afterwards, the timer continues
+    time.sleep(0.5)
+    assert int(hlwm.attr.timers.tick.fire_count()) > fire_count_after_resume
+
+
+def test_timer_shorter_interval_while_running(hlwm):
+    hlwm.call('timer add tick 100000 true')
+
+    hlwm.attr.timers.tick.interval = '50'
+    time.sleep(0.5)
+
+    assert hlwm.attr.timers.tick.running() == 'true'
+    assert int(hlwm.attr.timers.tick.fire_count()) >= 1
+
+
+def test_timer_longer_interval_while_running(hlwm):
+    hlwm.call('timer add tick 50 true')
+    time.sleep(0.2)
+
+    hlwm.attr.timers.tick.interval = '100000'
+    fire_count = hlwm.attr.timers.tick.fire_count()
+    time.sleep(0.3)
+
+    assert hlwm.attr.timers.tick.running() == 'true'
+    assert hlwm.attr.timers.tick.fire_count() == fire_count
+
+
+def test_timer_interval_change_while_stopped(hlwm):
+    hlwm.call('timer add tick 100000 true')
+    hlwm.call('timer stop tick')
+
+    hlwm.attr.timers.tick.interval = '50'
+    time.sleep(0.2)
+
+    assert hlwm.attr.timers.tick.running() == 'false'
+    assert hlwm.attr.timers.tick.fire_count() == '0'
+
+
+def test_timer_completion(hlwm):
+    hlwm.call('timer add foo 100000 true')
+
+    assert hlwm.complete(['timer']) == sorted(['add', 'remove', 'start', 'stop'])
+    for subcommand in ['remove', 'start', 'stop']:
+        assert hlwm.complete(['timer', subcommand]) == ['foo']
+        hlwm.command_has_all_args(['timer', subcommand, 'foo'])
+    assert '--once' in hlwm.complete(['timer', 'add', 'bar', '100'])
+    assert 'echo' in hlwm.complete(['timer', 'add', 'bar', '100', '--once'])
@@ -0,0 +1,156 @@
+// Compare the smart placement of floating windows in herbstluftwm with
+// the previous implementation, which checked every candidate position
+// against every other window.
+//
+//   placementbench [COUNT...]  benchmark the placement of a window among
+//                              COUNT random windows (default: 50 100 200 300)
+//   placementbench --check [SEED]
+//                              check on small random inputs that both
+//                              implementations choose the same position
+//
+// Build it via 'make placementbench'.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "floating.h"
+
+using std::pair;
+using std::vector;
+using Clock = std::chrono::steady_clock;
+using Rects = vector<pair<Rectangle, bool>>;
+
+static double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+//! the placement before it was computed in a sweep, in O(n^3)
+static Point2D previousSmartPlacement(const Rects& rects, Point2D size, Point2D area, int gap) {
+    std::unordered_set<int> xValues;
+    std::unordered_set<int> yValues;
+    for (const auto& it : rects) {
+        xValues.insert(it.first.x);
+        xValues.insert(it.first.x + it.first.width);
+        yValues.insert(it.first.y);
+        yValues.insert(it.first.y + it.first.height);
+    }
+    xValues.insert(gap);
+    yValues.insert(gap);
+    xValues.insert(area.x);
+    yValues.insert(area.y);
+    vector<Point2D> windowCorners = {
+        { 0, 0 }, { size.x, 0 }, { 0, size.y }, { size.x, size.y },
+    };
+    std::tuple<long long, long long, Point2D> best {
+        std::numeric_limits<long long>::max(),
+        std::numeric_limits<long long>::max(),
+        Point2D { gap, gap }
+    };
+    for (int x : xValues) {
+        for (int y : yValues) {
+            for (const auto& corner : windowCorners) {
+                Point2D topleft = { x - corner.x, y - corner.y };
+                if (topleft.x < 0 || topleft.y < 0
+                    || topleft.x + size.x > area.x || topleft.y + size.y > area.y) {
+                    continue;
+                }
+                long long overlapFloat = 0;
+                long long overlapTiling = 0;
+                for (const auto& otherWindow : rects) {
+                    const Rectangle& r = otherWindow.first;
+                    long long width = std::min(topleft.x + size.x, r.x + r.width)
+                                      - std::max(topleft.x, r.x);
+                    long long height = std::min(topleft.y + size.y, r.y + r.height)
+                                       - std::max(topleft.y, r.y);
+                    if (width <= 0 || height <= 0) {
+                        continue;
+                    }
+                    (otherWindow.second ? overlapFloat : overlapTiling) += width * height;
+                }
+                best = std::min(best, std::make_tuple(overlapFloat, overlapTiling, topleft));
+            }
+        }
+    }
+    return std::get<2>(best);
+}
+
+static Rects randomWindows(std::mt19937& rng, int count, Point2D area) {
+    Rects rects;
+    for (int i = 0; i < count; i++) {
+        int width = static_cast<int>(rng() % (area.x / 2)) + 1;
+        int height = static_cast<int>(rng() % (area.y / 2)) + 1;
+        int x = static_cast<int>(rng() % (area.x - width + 1));
+        int y = static_cast<int>(rng() % (area.y - height + 1));
+        rects.push_back({ Rectangle(x, y, width, height), rng() % 2 == 0 });
+    }
+    return rects;
+}
+
+static int benchmark(const vector<int>& counts) {
+    std::mt19937 rng(1);
+    const Point2D area = { 1920, 1080 };
+    const Point2D size = { 640, 480 };
+    const int gap = 5;
+    int differences = 0;
+    for (int count : counts) {
+        Rects rects = randomWindows(rng, count, area);
+        Clock::time_point start = Clock::now();
+        Point2D previous = previousSmartPlacement(rects, size, area, gap);
+        double previousTime = millisecondsSince(start);
+        start = Clock::now();
+        Point2D current = Floating::smartPlacement(rects, size, area, gap);
+        double currentTime = millisecondsSince(start);
+        printf("%4d windows: previous %9.1f ms, current %7.1f ms\n",
+               count, previousTime, currentTime);
+        if (previous != current) {
+            printf("error: the positions differ: %d,%d vs. %d,%d\n",
+                   previous.x, previous.y, current.x, current.y);
+            differences++;
+        }
+    }
+    return differences ? 1 : 0;
+}
+
+static int check(unsigned int seed) {
+    std::mt19937 rng(seed);
+    int differences = 0;
+    const int iterations = 3000;
+    for (int iteration = 0; iteration < iterations && differences < 30; iteration++) {
+        Point2D area = { static_cast<int>(rng() % 60) + 20, static_cast<int>(rng() % 60) + 20 };
+        Point2D size = { static_cast<int>(rng() % area.x) + 1,
+                         static_cast<int>(rng() % area.y) + 1 };
+        int gap = static_cast<int>(rng() % 3);
+        Rects rects = randomWindows(rng, static_cast<int>(rng() % 8), area);
+        Point2D previous = previousSmartPlacement(rects, size, area, gap);
+        Point2D current = Floating::smartPlacement(rects, size, area, gap);
+        if (previous != current) {
+            printf("position mismatch in case %d: previous %d,%d, current %d,%d\n",
+                   iteration, previous.x, previous.y, current.x, current.y);
+            differences++;
+        }
+    }
+    printf("%d cases checked, %d mismatches\n", iterations, differences);
+    return differences ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 2 && !strcmp(argv[1], "--check")) {
+        return check(argc >= 3 ? static_cast<unsigned int>(atoi(argv[2])) : 1);
+    }
+    vector<int> counts;
+    for (int i = 1; i < argc; i++) {
+        counts.push_back(atoi(argv[i]));
+    }
+    if (counts.empty()) {
+        counts = { 50, 100, 200, 300 };
+    }
+    return benchmark(counts);
+}
@@ -0,0 +1,205 @@
+// Compare the RegexEngine of herbstluftwm with std::regex.
+//
+//   regexbench [PATTERNFILE]  benchmark compiling and matching the regexes
+//                             in PATTERNFILE (one per line), or a set of
+//                             800 rule-like regexes if no file is given
+//   regexbench --fuzz [SEED]  check on random regexes that RegexEngine
+//                             accepts, rejects and matches exactly as
+//                             std::regex does, including error messages
+//
+// Build it via 'make regexbench'.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "regexengine.h"
+
+using std::string;
+using std::vector;
+using Clock = std::chrono::steady_clock;
+
+static double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static vector<string> rulePatterns() {
+    vector<string> patterns;
+    for (int i = 0; i < 800; i++) {
+        if (i % 2) {
+            patterns.push_back("(firefox|chromium)-" + std::to_string(i) + "[a-z]*.*");
+        } else {
+            patterns.push_back(".*[Tt]erm(inal)?-" + std::to_string(i));
+        }
+    }
+    return patterns;
+}
+
+static int benchmark(const vector<string>& patterns) {
+    const vector<string> subjects = {
+        "firefox-12abc - Mozilla Firefox",
+        "some terminal window title that is rather long",
+        "chromium-799",
+        "xterm-42",
+    };
+    const int rounds = 25;
+    Clock::time_point start = Clock::now();
+    vector<std::regex> stdRegexes;
+    for (const auto& pattern : patterns) {
+        stdRegexes.emplace_back(pattern, std::regex::extended);
+    }
+    double stdCompile = millisecondsSince(start);
+    start = Clock::now();
+    vector<RegexEngine> engines;
+    for (const auto& pattern : patterns) {
+        engines.emplace_back(pattern);
+    }
+    double engineCompile = millisecondsSince(start);
+
+    start = Clock::now();
+    long stdMatches = 0;
+    for (int round = 0; round < rounds; round++) {
+        for (const auto& regex : stdRegexes) {
+            for (const auto& subject : subjects) {
+                stdMatches += std::regex_match(subject, regex);
+            }
+        }
+    }
+    double stdMatch = millisecondsSince(start);
+    start = Clock::now();
+    long engineMatches = 0;
+    double engineMatchCold = 0;
+    for (int round = 0; round < rounds; round++) {
+        for (const auto& regex : engines) {
+            for (const auto& subject : subjects) {
+                engineMatches += regex.matches(subject);
+            }
+        }
+        if (round == 0) {
+            // the first round builds the DFA states
+            engineMatchCold = millisecondsSince(start);
+        }
+    }
+    double engineMatch = millisecondsSince(start);
+    long usingAutomaton = 0;
+    for (const auto& regex : engines) {
+        usingAutomaton += regex.usesAutomaton();
+    }
+    printf("%zu regexes (%ld via the automaton), %zu subjects, %d rounds\n",
+           patterns.size(), usingAutomaton, subjects.size(), rounds);
+    printf("compile: std::regex %8.1f ms, RegexEngine %8.1f ms\n",
+           stdCompile, engineCompile);
+    printf("match:   std::regex %8.1f ms, RegexEngine %8.1f ms (first round %.1f ms)\n",
+           stdMatch, engineMatch, engineMatchCold);
+    if (stdMatches != engineMatches) {
+        printf("error: the number of matches differs: %ld vs. %ld\n",
+               stdMatches, engineMatches);
+        return 1;
+    }
+    return 0;
+}
+
+static int fuzz(unsigned int seed) {
+    std::mt19937 rng(seed);
+    const string alphabet = "ab().*+?|[]^$-{},\\:12 ";
+    const vector<string> snippets = {
+        "[:alpha:]", "[:digit:]", "{1,3}", "{2}", "{0,}", "[^a]", "[a-c]",
+        "[]a]", "[a-]", "[[:space:][:upper:]]", "[^[:alnum:]]",
+    };
+    const string subjectAlphabet = string("ab1.- ]\\^$\nA\t\xe4:", 16) + string(1, '\0');
+    long valid = 0, mismatches = 0;
+    for (int iteration = 0; iteration < 300000 && mismatches < 30; iteration++) {
+        string pattern;
+        int length = static_cast<int>(rng() % 8) + 1;
+        for (int i = 0; i < length; i++) {
+            if (rng() % 5 == 0) {
+                pattern += snippets[rng() % snippets.size()];
+            } else {
+                pattern += alphabet[rng() % alphabet.size()];
+            }
+        }
+        // libstdc++ has its own opinion about repeated repetitions
+        bool repeatedRepetition = false;
+        for (size_t i = 1; i < pattern.size(); i++) {
+            if (strchr("*+?}", pattern[i]) && strchr("*+?}", pattern[i - 1])) {
+                repeatedRepetition = true;
+            }
+        }
+        if (repeatedRepetition) {
+            continue;
+        }
+        string stdError, engineError;
+        std::regex stdRegex;
+        try {
+            stdRegex = std::regex(pattern, std::regex::extended);
+        } catch (const std::regex_error& e) {
+            stdError = e.what();
+        }
+        RegexEngine engine;
+        try {
+            engine = RegexEngine(pattern);
+        } catch (const std::regex_error& e) {
+            engineError = e.what();
+        }
+        if (stdError != engineError) {
+            printf("error mismatch for '%s': std::regex '%s', RegexEngine '%s'\n",
+                   pattern.c_str(), stdError.c_str(), engineError.c_str());
+            mismatches++;
+            continue;
+        }
+        if (!stdError.empty()) {
+            continue;
+        }
+        valid++;
+        for (int k = 0; k < 30; k++) {
+            string subject;
+            int subjectLength = static_cast<int>(rng() % 7);
+            for (int i = 0; i < subjectLength; i++) {
+                subject += subjectAlphabet[rng() % subjectAlphabet.size()];
+            }
+            bool stdMatch = std::regex_match(subject, stdRegex);
+            if (stdMatch != engine.matches(subject)) {
+                printf("match mismatch for '%s' on '%s': std::regex %d\n",
+                       pattern.c_str(), subject.c_str(), stdMatch);
+                mismatches++;
+                break;
+            }
+        }
+    }
+    printf("%ld valid regexes checked, %ld mismatches\n", valid, mismatches);
+    return mismatches ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 2 && !strcmp(argv[1], "--fuzz")) {
+        return fuzz(argc >= 3 ? static_cast<unsigned int>(atoi(argv[2])) : 1);
+    }
+    if (argc >= 2) {
+        std::ifstream file(argv[1]);
+        if (!file) {
+            fprintf(stderr, "Can not open %s\n", argv[1]);
+            return 1;
+        }
+        vector<string> patterns;
+        string line;
+        while (std::getline(file, line)) {
+            if (line.empty()) {
+                continue;
+            }
+            try {
+                std::regex(line, std::regex::extended);
+                patterns.push_back(line);
+            } catch (const std::regex_error& e) {
+                fprintf(stderr, "Skipping invalid regex '%s': %s\n", line.c_str(), e.what());
+            }
+        }
+        return benchmark(patterns);
+    }
+    return benchmark(rulePatterns());
+}